@@ -11,13 +11,11 @@
 
 // Standard library
 #include <stdio.h>
+#include <stddef.h>
 #include <string.h>
 #include <stdlib.h>
 #include <stdbool.h>
 
-// log submodule
-#include <log/log.h>
-
 // sync submodule
 #include <sync/sync.h>
 
@@ -35,19 +33,106 @@
 
 // Forward declarations
 struct stack_s;
+struct record_stack_s;
+struct stack_arena_s;
+struct stack_pool_s;
+struct pool_stack_s;
+struct shared_stack_s;
+struct priority_stack_s;
+struct ring_stack_s;
+struct mru_stack_s;
+struct stack_node_s;
+struct intrusive_stack_s;
+struct lockfree_stack_s;
 
 // Type definitions
-typedef struct stack_s stack;
+typedef struct stack_s           stack;
+typedef struct record_stack_s    record_stack;
+typedef struct stack_arena_s     stack_arena;
+typedef struct stack_pool_s      stack_pool;
+typedef struct pool_stack_s      pool_stack;
+typedef struct shared_stack_s    shared_stack;
+typedef struct priority_stack_s  priority_stack;
+typedef struct ring_stack_s      ring_stack;
+typedef struct mru_stack_s       mru_stack;
+typedef struct stack_node_s      stack_node;
+typedef struct intrusive_stack_s intrusive_stack;
+typedef struct lockfree_stack_s  lockfree_stack;
+
+/** !
+ * Associative function that combines two values of an augmented stack
+ * 
+ * @param p_a the aggregate of the elements beneath
+ * @param p_b the value being pushed
+ * 
+ * @return the combined value
+ */
+typedef const void *(fn_stack_combine)( const void *const p_a, const void *const p_b );
+
+/** !
+ * Called on each element of a stack during iteration
+ * 
+ * @param p_value the element
+ * @param i       the index of the element from the top of the stack
+ * 
+ * @return void
+ */
+typedef void (fn_stack_for_each)( const void *const p_value, size_t i );
+
+/** !
+ * Called when the quantity of elements in a stack crosses a watermark. The
+ * stack is locked, so the function must not call stack functions on it
+ * 
+ * @param p_stack the stack
+ * @param high    true if the high watermark was reached, false if the low watermark was reached
+ * 
+ * @return void
+ */
+typedef void (fn_stack_watermark)( stack *const p_stack, bool high );
+
+/** !
+ * Hash an element of an MRU stack. Equal elements must have equal hashes
+ * 
+ * @param p_value the element
+ * 
+ * @return the hash
+ */
+typedef size_t (fn_stack_hash)( const void *const p_value );
+
+/** !
+ * Compare two elements of an MRU stack
+ * 
+ * @param p_a the first element
+ * @param p_b the second element
+ * 
+ * @return true if the elements are equal, else false
+ */
+typedef bool (fn_stack_equal)( const void *const p_a, const void *const p_b );
+
+// Structures
+/** !
+ * Embed a stack node in an object to push the object onto an intrusive or 
+ * lock free stack without allocating. Use STACK_CONTAINER_OF to get the 
+ * object back from its node
+ */
+struct stack_node_s
+{
+    struct stack_node_s *p_next; // The node below, or null
+};
+
+// Preprocessor macros
+#define STACK_CONTAINER_OF(p_node, type, member) ( (type *) ( (char *) (p_node) - offsetof(type, member) ) )
 
 // Initializer
 /** !
- * This gets called at runtime before main. 
+ * Initialize the stack library. This gets called by the first constructor, 
+ * so calling it is only necessary to initialize eagerly. Thread safe.
  * 
  * @param void
  * 
  * @return void
  */
-DLLEXPORT void stack_init ( void ) __attribute__((constructor));
+DLLEXPORT void stack_init ( void );
 
 // Constructors 
 /** !
@@ -61,6 +146,33 @@ DLLEXPORT void stack_init ( void ) __attribute__((constructor));
 */
 DLLEXPORT int stack_construct ( stack **const pp_stack, size_t size );
 
+/** !
+ * Construct a stack of a specified size that maintains a running aggregate of 
+ * its elements. The aggregate of the whole stack is available in constant time
+ * 
+ * @param pp_stack    result
+ * @param size        the maximum quantity of elements
+ * @param pfn_combine an associative function, like min, max or sum
+ * 
+ * @sa stack_aggregate
+ * @sa stack_destroy
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_construct_augmented ( stack **const pp_stack, size_t size, fn_stack_combine *pfn_combine );
+
+/** !
+ * Construct a copy of a stack
+ * 
+ * @param p_stack  the stack
+ * @param pp_clone result
+ * 
+ * @sa stack_destroy
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_clone ( stack *const p_stack, stack **const pp_clone );
+
 // Mutators
 /** !
  * Push a value onto a stack
@@ -74,6 +186,76 @@ DLLEXPORT int stack_construct ( stack **const pp_stack, size_t size );
 */
 DLLEXPORT int stack_push ( stack *const p_stack, const void *const p_value );
 
+/** !
+ * Start a frame at the top of a stack
+ * 
+ * @param p_stack the stack
+ * @param p_frame result
+ * 
+ * @sa stack_frame_pop
+ * @sa stack_frame_get
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_frame_push ( stack *const p_stack, size_t *const p_frame );
+
+/** !
+ * Discard every value pushed since a frame started, in one operation
+ * 
+ * @param p_stack the stack
+ * @param frame   a frame from stack_frame_push
+ * 
+ * @sa stack_frame_push
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_frame_pop ( stack *const p_stack, size_t frame );
+
+/** !
+ * Pop every value off a stack at once. The stack is locked for a single copy,
+ * so the caller can process the values without blocking other threads. If 
+ * the stack holds more than capacity values, only the top capacity values 
+ * are taken
+ * 
+ * @param p_stack  the stack
+ * @param p_values result, bottom first
+ * @param capacity the quantity of values that fit in p_values
+ * @param p_count  result
+ * 
+ * @sa stack_pop
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_drain ( stack *const p_stack, const void **const p_values, size_t capacity, size_t *const p_count );
+
+/** !
+ * Move elements from the top of one stack to the top of another, preserving
+ * their order. Both stacks are locked once, in a consistent order
+ * 
+ * @param p_destination the destination stack
+ * @param p_source      the source stack
+ * @param count         the quantity of elements to move
+ * 
+ * @sa stack_steal_half
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_splice ( stack *const p_destination, stack *const p_source, size_t count );
+
+/** !
+ * Move the top half of one stack, rounded up, to the top of another. Fewer
+ * elements are moved if the destination is nearly full
+ * 
+ * @param p_destination the destination stack
+ * @param p_source      the source stack
+ * @param p_count       result, or null
+ * 
+ * @sa stack_splice
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_steal_half ( stack *const p_destination, stack *const p_source, size_t *const p_count );
+
 /** !
  * Pop a value off a stack
  * 
@@ -99,6 +281,149 @@ DLLEXPORT int stack_pop ( stack *const p_stack, const void **const ret );
 */
 DLLEXPORT int stack_peek ( stack *const p_stack, const void **const ret );
 
+/** !
+ * Get the aggregate of every element in an augmented stack
+ * 
+ * @param p_stack the stack
+ * @param ret result
+ * 
+ * @sa stack_construct_augmented
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_aggregate ( stack *const p_stack, const void **const ret );
+
+/** !
+ * Get the quantity of elements in a stack
+ * 
+ * @param p_stack the stack
+ * @param p_count result
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_count ( stack *const p_stack, size_t *const p_count );
+
+/** !
+ * Get an element of a stack
+ * 
+ * @param p_stack the stack
+ * @param index   the index of the element from the top of the stack
+ * @param ret     result
+ * 
+ * @sa stack_peek
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_get ( stack *const p_stack, size_t index, const void **const ret );
+
+/** !
+ * Get an element of a stack, relative to the base of a frame
+ * 
+ * @param p_stack the stack
+ * @param frame   a frame from stack_frame_push
+ * @param index   the index of the element from the base of the frame
+ * @param ret     result
+ * 
+ * @sa stack_frame_push
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_frame_get ( stack *const p_stack, size_t frame, size_t index, const void **const ret );
+
+/** !
+ * Find the topmost occurrence of a value in a stack
+ * 
+ * @param p_stack the stack
+ * @param p_value the value
+ * @param p_index result, or null
+ * 
+ * @sa stack_contains
+ * 
+ * @return 1 if found, 0 if not found or on error
+*/
+DLLEXPORT int stack_find ( stack *const p_stack, const void *const p_value, size_t *const p_index );
+
+/** !
+ * Test if a stack contains a value
+ * 
+ * @param p_stack the stack
+ * @param p_value the value
+ * 
+ * @sa stack_find
+ * 
+ * @return 1 if found, 0 if not found or on error
+*/
+DLLEXPORT int stack_contains ( stack *const p_stack, const void *const p_value );
+
+// Iterators
+/** !
+ * Call a function on each element of a stack, from top to bottom. The stack
+ * is locked for the duration, so the function must not modify the stack
+ * 
+ * @param p_stack      the stack
+ * @param pfn_for_each the function
+ * 
+ * @sa stack_for_each_reverse
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_for_each ( stack *const p_stack, fn_stack_for_each *pfn_for_each );
+
+/** !
+ * Call a function on each element of a stack, from bottom to top. The stack
+ * is locked for the duration, so the function must not modify the stack
+ * 
+ * @param p_stack      the stack
+ * @param pfn_for_each the function
+ * 
+ * @sa stack_for_each
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_for_each_reverse ( stack *const p_stack, fn_stack_for_each *pfn_for_each );
+
+// Notifications
+/** !
+ * Set the high and low watermarks of a stack. The watermark function is 
+ * called once when a push reaches the high watermark, then once when a pop
+ * reaches the low watermark, and so on
+ * 
+ * @param p_stack       the stack
+ * @param high          the high watermark, no more than the size of the stack
+ * @param low           the low watermark, less than the high watermark
+ * @param pfn_watermark the watermark function, or null to disable watermarks
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_watermark_set ( stack *const p_stack, size_t high, size_t low, fn_stack_watermark *pfn_watermark );
+
+/** !
+ * Enable readiness notifications for a stack. The file descriptor becomes
+ * readable when the stack goes from empty to non-empty, and when the quantity
+ * of elements falls below the threshold. Notifications are edge triggered; 
+ * read the file descriptor to rearm it. Linux only.
+ * 
+ * @param p_stack   the stack
+ * @param threshold signal when the quantity of elements falls below this value, or 0
+ * @param p_fd      result
+ * 
+ * @sa stack_notify_disable
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_notify_enable ( stack *const p_stack, size_t threshold, int *const p_fd );
+
+/** !
+ * Disable readiness notifications for a stack, and close the file descriptor
+ * 
+ * @param p_stack the stack
+ * 
+ * @sa stack_notify_enable
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_notify_disable ( stack *const p_stack );
+
 // Destructors
 /** !
  * Deallocate a stack
@@ -111,9 +436,750 @@ DLLEXPORT int stack_peek ( stack *const p_stack, const void **const ret );
 */
 DLLEXPORT int stack_destroy ( stack **const pp_stack );
 
+// Record stack
+/** !
+ * Construct a stack of variable length records
+ * 
+ * @param pp_record_stack result
+ * @param size            the quantity of bytes for records and their bookkeeping
+ * 
+ * @sa record_stack_destroy
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int record_stack_construct ( record_stack **const pp_record_stack, size_t size );
+
+/** !
+ * Reserve space for a record on top of a record stack. The caller writes the
+ * record directly into the reservation, then calls record_stack_commit or 
+ * record_stack_cancel. The stack stays locked until then. A thread may only 
+ * hold one reservation at a time, and only the reserving thread may commit
+ * or cancel it.
+ * 
+ * @param p_record_stack the record stack
+ * @param size           the maximum quantity of bytes in the record
+ * @param pp_data        result
+ * 
+ * @sa record_stack_commit
+ * @sa record_stack_cancel
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int record_stack_reserve ( record_stack *const p_record_stack, size_t size, void **const pp_data );
+
+/** !
+ * Push the reserved record onto a record stack, and unlock the record stack.
+ * If size exceeds the reservation, the reservation is dropped, the record 
+ * stack is unlocked, and nothing is pushed
+ * 
+ * @param p_record_stack the record stack
+ * @param size           the quantity of bytes written, no more than the reservation
+ * 
+ * @sa record_stack_reserve
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int record_stack_commit ( record_stack *const p_record_stack, size_t size );
+
+/** !
+ * Drop the reserved record, and unlock the record stack
+ * 
+ * @param p_record_stack the record stack
+ * 
+ * @sa record_stack_reserve
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int record_stack_cancel ( record_stack *const p_record_stack );
+
+/** !
+ * Copy a record onto a record stack
+ * 
+ * @param p_record_stack the record stack
+ * @param p_data         the record
+ * @param size           the quantity of bytes in the record
+ * 
+ * @sa record_stack_pop
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int record_stack_push ( record_stack *const p_record_stack, const void *const p_data, size_t size );
+
+/** !
+ * Pop a record off a record stack. The result points into the record stack,
+ * and is valid until the next push
+ * 
+ * @param p_record_stack the record stack
+ * @param pp_data        result, or null
+ * @param p_size         result, or null
+ * 
+ * @sa record_stack_push
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int record_stack_pop ( record_stack *const p_record_stack, const void **const pp_data, size_t *const p_size );
+
+/** !
+ * Peek the record on top of a record stack
+ * 
+ * @param p_record_stack the record stack
+ * @param pp_data        result
+ * @param p_size         result, or null
+ * 
+ * @sa record_stack_pop
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int record_stack_peek ( record_stack *const p_record_stack, const void **const pp_data, size_t *const p_size );
+
+/** !
+ * Deallocate a record stack
+ * 
+ * @param pp_record_stack pointer to record stack pointer
+ * 
+ * @sa record_stack_construct
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int record_stack_destroy ( record_stack **const pp_record_stack );
+
+// Scratch arena
+/** !
+ * Construct a scratch arena. Blocks are allocated by bumping a pointer, and
+ * released in LIFO order by returning to a mark
+ * 
+ * @param pp_stack_arena result
+ * @param size           the quantity of bytes in the arena
+ * 
+ * @sa stack_arena_destroy
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_arena_construct ( stack_arena **const pp_stack_arena, size_t size );
+
+/** !
+ * Allocate a block from the top of a scratch arena
+ * 
+ * @param p_stack_arena the scratch arena
+ * @param size          the quantity of bytes in the block
+ * @param alignment     a power of two, or 0 for the alignment of max_align_t
+ * @param pp_block      result
+ * 
+ * @sa stack_arena_release
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_arena_alloc ( stack_arena *const p_stack_arena, size_t size, size_t alignment, void **const pp_block );
+
+/** !
+ * Get the top of a scratch arena
+ * 
+ * @param p_stack_arena the scratch arena
+ * @param p_mark        result
+ * 
+ * @sa stack_arena_release
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_arena_mark ( stack_arena *const p_stack_arena, size_t *const p_mark );
+
+/** !
+ * Release every block allocated after a mark
+ * 
+ * @param p_stack_arena the scratch arena
+ * @param mark          a mark from stack_arena_mark, or 0 to release everything
+ * 
+ * @sa stack_arena_mark
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_arena_release ( stack_arena *const p_stack_arena, size_t mark );
+
+/** !
+ * Deallocate a scratch arena
+ * 
+ * @param pp_stack_arena pointer to scratch arena pointer
+ * 
+ * @sa stack_arena_construct
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_arena_destroy ( stack_arena **const pp_stack_arena );
+
+// Stack pool
+/** !
+ * Construct a pool of small stacks. Stacks are carved from large slabs, carry
+ * only an element count, and share a fixed set of striped locks
+ * 
+ * @param pp_stack_pool result
+ * @param size          the quantity of elements that could fit in each stack
+ * @param slab_stacks   the quantity of stacks in each slab
+ * @param stripes       the quantity of locks shared by the stacks
+ * 
+ * @sa stack_pool_destroy
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_pool_construct ( stack_pool **const pp_stack_pool, size_t size, size_t slab_stacks, size_t stripes );
+
+/** !
+ * Get an empty stack from a stack pool
+ * 
+ * @param p_stack_pool  the stack pool
+ * @param pp_pool_stack result
+ * 
+ * @sa stack_pool_release
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_pool_acquire ( stack_pool *const p_stack_pool, pool_stack **const pp_pool_stack );
+
+/** !
+ * Push a value onto a pooled stack
+ * 
+ * @param p_stack_pool the stack pool
+ * @param p_pool_stack the pooled stack
+ * @param p_value      the value
+ * 
+ * @sa stack_pool_pop
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_pool_push ( stack_pool *const p_stack_pool, pool_stack *const p_pool_stack, const void *const p_value );
+
+/** !
+ * Pop a value off a pooled stack
+ * 
+ * @param p_stack_pool the stack pool
+ * @param p_pool_stack the pooled stack
+ * @param ret          result, or null
+ * 
+ * @sa stack_pool_push
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_pool_pop ( stack_pool *const p_stack_pool, pool_stack *const p_pool_stack, const void **const ret );
+
+/** !
+ * Peek the top of a pooled stack
+ * 
+ * @param p_stack_pool the stack pool
+ * @param p_pool_stack the pooled stack
+ * @param ret          result
+ * 
+ * @sa stack_pool_pop
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_pool_peek ( stack_pool *const p_stack_pool, pool_stack *const p_pool_stack, const void **const ret );
+
+/** !
+ * Return a stack to a stack pool
+ * 
+ * @param p_stack_pool  the stack pool
+ * @param pp_pool_stack pointer to pooled stack pointer
+ * 
+ * @sa stack_pool_acquire
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_pool_release ( stack_pool *const p_stack_pool, pool_stack **const pp_pool_stack );
+
+/** !
+ * Deallocate a stack pool, and every stack acquired from it
+ * 
+ * @param pp_stack_pool pointer to stack pool pointer
+ * 
+ * @sa stack_pool_construct
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int stack_pool_destroy ( stack_pool **const pp_stack_pool );
+
+// Priority stack
+/** !
+ * Construct a stack with priority levels. Values are LIFO within a level, and
+ * pop takes from the highest level that is not empty, in constant time
+ * 
+ * @param pp_priority_stack result
+ * @param levels            the quantity of priority levels, no more than 64
+ * @param size              the quantity of elements that could fit in each level
+ * 
+ * @sa priority_stack_destroy
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int priority_stack_construct ( priority_stack **const pp_priority_stack, size_t levels, size_t size );
+
+/** !
+ * Push a value onto a level of a priority stack
+ * 
+ * @param p_priority_stack the priority stack
+ * @param level            the priority level. Higher levels are popped first
+ * @param p_value          the value
+ * 
+ * @sa priority_stack_pop
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int priority_stack_push ( priority_stack *const p_priority_stack, size_t level, const void *const p_value );
+
+/** !
+ * Pop a value off the highest level of a priority stack that is not empty
+ * 
+ * @param p_priority_stack the priority stack
+ * @param ret              result, or null
+ * @param p_level          result, or null
+ * 
+ * @sa priority_stack_push
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int priority_stack_pop ( priority_stack *const p_priority_stack, const void **const ret, size_t *const p_level );
+
+/** !
+ * Peek the top of the highest level of a priority stack that is not empty
+ * 
+ * @param p_priority_stack the priority stack
+ * @param ret              result
+ * @param p_level          result, or null
+ * 
+ * @sa priority_stack_pop
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int priority_stack_peek ( priority_stack *const p_priority_stack, const void **const ret, size_t *const p_level );
+
+/** !
+ * Deallocate a priority stack
+ * 
+ * @param pp_priority_stack pointer to priority stack pointer
+ * 
+ * @sa priority_stack_construct
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int priority_stack_destroy ( priority_stack **const pp_priority_stack );
+
+// Ring stack
+/** !
+ * Construct a bounded history. It is a stack, except that a push at capacity
+ * evicts the bottom element instead of failing
+ * 
+ * @param pp_ring_stack result
+ * @param size          the quantity of elements to remember
+ * 
+ * @sa ring_stack_destroy
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int ring_stack_construct ( ring_stack **const pp_ring_stack, size_t size );
+
+/** !
+ * Push a value onto a ring stack, evicting the bottom element if it is full
+ * 
+ * @param p_ring_stack the ring stack
+ * @param p_value      the value
+ * @param p_evicted    result, null if nothing was evicted. May be null
+ * 
+ * @sa ring_stack_pop
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int ring_stack_push ( ring_stack *const p_ring_stack, const void *const p_value, const void **const p_evicted );
+
+/** !
+ * Pop a value off a ring stack
+ * 
+ * @param p_ring_stack the ring stack
+ * @param ret          result, or null
+ * 
+ * @sa ring_stack_push
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int ring_stack_pop ( ring_stack *const p_ring_stack, const void **const ret );
+
+/** !
+ * Get an element of a ring stack
+ * 
+ * @param p_ring_stack the ring stack
+ * @param index        the index of the element from the top of the stack
+ * @param ret          result
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int ring_stack_get ( ring_stack *const p_ring_stack, size_t index, const void **const ret );
+
+/** !
+ * Get the quantity of elements in a ring stack, and the quantity evicted 
+ * 
+ * @param p_ring_stack the ring stack
+ * @param p_count      result, or null
+ * @param p_evictions  result, or null
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int ring_stack_count ( ring_stack *const p_ring_stack, size_t *const p_count, size_t *const p_evictions );
+
+/** !
+ * Deallocate a ring stack
+ * 
+ * @param pp_ring_stack pointer to ring stack pointer
+ * 
+ * @sa ring_stack_construct
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int ring_stack_destroy ( ring_stack **const pp_ring_stack );
+
+// MRU stack
+/** !
+ * Construct a most recently used stack. Pushing or touching an element moves
+ * it to the top, and a push at capacity evicts the bottom element, each in
+ * constant time
+ * 
+ * @param pp_mru_stack result
+ * @param size         the quantity of elements to remember
+ * @param pfn_hash     hashes an element, or null to hash the address
+ * @param pfn_equal    compares two elements, or null to compare addresses
+ * 
+ * @sa mru_stack_destroy
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int mru_stack_construct ( mru_stack **const pp_mru_stack, size_t size, fn_stack_hash *pfn_hash, fn_stack_equal *pfn_equal );
+
+/** !
+ * Push a value onto an MRU stack. If an equal value is present, it is 
+ * replaced and moved to the top. Else, if the stack is full, the bottom 
+ * element is evicted
+ * 
+ * @param p_mru_stack the MRU stack
+ * @param p_value     the value
+ * @param p_evicted   result, the replaced or evicted element, or null. May be null
+ * 
+ * @sa mru_stack_pop
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int mru_stack_push ( mru_stack *const p_mru_stack, const void *const p_value, const void **const p_evicted );
+
+/** !
+ * Move a value to the top of an MRU stack
+ * 
+ * @param p_mru_stack the MRU stack
+ * @param p_value     the value, or an equal value
+ * @param ret         result, the stored value, or null
+ * 
+ * @return 1 if the value was found, 0 if not found or on error
+*/
+DLLEXPORT int mru_stack_touch ( mru_stack *const p_mru_stack, const void *const p_value, const void **const ret );
+
+/** !
+ * Remove a value from an MRU stack
+ * 
+ * @param p_mru_stack the MRU stack
+ * @param p_value     the value, or an equal value
+ * @param ret         result, the stored value, or null
+ * 
+ * @return 1 if the value was removed, 0 if not found or on error
+*/
+DLLEXPORT int mru_stack_remove ( mru_stack *const p_mru_stack, const void *const p_value, const void **const ret );
+
+/** !
+ * Pop the most recently used value off an MRU stack
+ * 
+ * @param p_mru_stack the MRU stack
+ * @param ret         result, or null
+ * 
+ * @sa mru_stack_pop_bottom
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int mru_stack_pop ( mru_stack *const p_mru_stack, const void **const ret );
+
+/** !
+ * Pop the least recently used value off an MRU stack
+ * 
+ * @param p_mru_stack the MRU stack
+ * @param ret         result, or null
+ * 
+ * @sa mru_stack_pop
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int mru_stack_pop_bottom ( mru_stack *const p_mru_stack, const void **const ret );
+
+/** !
+ * Get the most recently used value of an MRU stack
+ * 
+ * @param p_mru_stack the MRU stack
+ * @param ret         result
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int mru_stack_peek ( mru_stack *const p_mru_stack, const void **const ret );
+
+/** !
+ * Get the quantity of elements in an MRU stack
+ * 
+ * @param p_mru_stack the MRU stack
+ * @param p_count     result
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int mru_stack_count ( mru_stack *const p_mru_stack, size_t *const p_count );
+
+/** !
+ * Deallocate an MRU stack
+ * 
+ * @param pp_mru_stack pointer to MRU stack pointer
+ * 
+ * @sa mru_stack_construct
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int mru_stack_destroy ( mru_stack **const pp_mru_stack );
+
+// Intrusive stack
+/** !
+ * Construct an intrusive stack. The links live in the caller's objects, so 
+ * there is no capacity, and pushing and popping never allocate
+ * 
+ * @param pp_intrusive_stack result
+ * 
+ * @sa intrusive_stack_destroy
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int intrusive_stack_construct ( intrusive_stack **const pp_intrusive_stack );
+
+/** !
+ * Push a node onto an intrusive stack
+ * 
+ * @param p_intrusive_stack the intrusive stack
+ * @param p_node            the node. It must not be on any stack
+ * 
+ * @sa intrusive_stack_pop
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int intrusive_stack_push ( intrusive_stack *const p_intrusive_stack, stack_node *const p_node );
+
+/** !
+ * Pop a node off an intrusive stack
+ * 
+ * @param p_intrusive_stack the intrusive stack
+ * @param ret               result, or null
+ * 
+ * @sa intrusive_stack_push
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int intrusive_stack_pop ( intrusive_stack *const p_intrusive_stack, stack_node **const ret );
+
+/** !
+ * Pop every node off an intrusive stack at once
+ * 
+ * @param p_intrusive_stack the intrusive stack
+ * @param ret               result, the top node linked to the rest, or null if the stack was empty
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int intrusive_stack_pop_all ( intrusive_stack *const p_intrusive_stack, stack_node **const ret );
+
+/** !
+ * Move every node of one intrusive stack to the top of another, preserving
+ * their order. Only the source's bottom node is relinked, so this takes 
+ * constant time. Both stacks are locked once, in a consistent order
+ * 
+ * @param p_destination the destination stack
+ * @param p_source      the source stack
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int intrusive_stack_splice ( intrusive_stack *const p_destination, intrusive_stack *const p_source );
+
+/** !
+ * Get the top node of an intrusive stack
+ * 
+ * @param p_intrusive_stack the intrusive stack
+ * @param ret               result
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int intrusive_stack_peek ( intrusive_stack *const p_intrusive_stack, stack_node **const ret );
+
+/** !
+ * Deallocate an intrusive stack. The nodes are not touched
+ * 
+ * @param pp_intrusive_stack pointer to intrusive stack pointer
+ * 
+ * @sa intrusive_stack_construct
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int intrusive_stack_destroy ( intrusive_stack **const pp_intrusive_stack );
+
+// Lock free stack
+/** !
+ * Construct a lock free intrusive stack. The top pointer is tagged with a 
+ * count of updates, so a node that is popped and pushed back between another
+ * thread's read and compare exchange is detected. Nodes may be reused, but 
+ * their memory must stay readable while any thread might pop them, as in a 
+ * free list of preallocated objects
+ * 
+ * @param pp_lockfree_stack result
+ * 
+ * @sa lockfree_stack_destroy
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int lockfree_stack_construct ( lockfree_stack **const pp_lockfree_stack );
+
+/** !
+ * Push a node onto a lock free stack
+ * 
+ * @param p_lockfree_stack the lock free stack
+ * @param p_node           the node. It must not be on any stack
+ * 
+ * @sa lockfree_stack_pop
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int lockfree_stack_push ( lockfree_stack *const p_lockfree_stack, stack_node *const p_node );
+
+/** !
+ * Pop a node off a lock free stack
+ * 
+ * @param p_lockfree_stack the lock free stack
+ * @param ret              result, or null
+ * 
+ * @sa lockfree_stack_push
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int lockfree_stack_pop ( lockfree_stack *const p_lockfree_stack, stack_node **const ret );
+
+/** !
+ * Pop every node off a lock free stack at once
+ * 
+ * @param p_lockfree_stack the lock free stack
+ * @param ret              result, the top node linked to the rest, or null if the stack was empty
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int lockfree_stack_pop_all ( lockfree_stack *const p_lockfree_stack, stack_node **const ret );
+
+/** !
+ * Deallocate a lock free stack. The nodes are not touched
+ * 
+ * @param pp_lockfree_stack pointer to lock free stack pointer
+ * 
+ * @sa lockfree_stack_construct
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int lockfree_stack_destroy ( lockfree_stack **const pp_lockfree_stack );
+
+// Shared stack
+#ifdef __linux__
+/** !
+ * Get the quantity of bytes needed for a shared stack
+ * 
+ * @param size          the quantity of elements that could fit in the stack
+ * @param p_region_size result
+ * 
+ * @sa shared_stack_construct
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int shared_stack_region_size ( size_t size, size_t *const p_region_size );
+
+/** !
+ * Construct a stack in a region of memory that is shared between processes,
+ * like a shm_open or memfd_create mapping. Elements must point into the same
+ * region; they are stored as offsets, so each process can map the region at 
+ * a different address. The lock is robust, and is recovered if a process 
+ * dies while holding it
+ * 
+ * @param pp_shared_stack result
+ * @param p_region        the shared memory
+ * @param region_size     the quantity of bytes in the shared memory
+ * 
+ * @sa shared_stack_attach
+ * @sa shared_stack_destroy
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int shared_stack_construct ( shared_stack **const pp_shared_stack, void *const p_region, size_t region_size );
+
+/** !
+ * Use a shared stack that was constructed by another process
+ * 
+ * @param pp_shared_stack result
+ * @param p_region        this process's mapping of the shared memory
+ * 
+ * @sa shared_stack_construct
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int shared_stack_attach ( shared_stack **const pp_shared_stack, void *const p_region );
+
+/** !
+ * Push a value onto a shared stack
+ * 
+ * @param p_shared_stack the shared stack
+ * @param p_value        the value, in the shared memory
+ * 
+ * @sa shared_stack_pop
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int shared_stack_push ( shared_stack *const p_shared_stack, const void *const p_value );
+
+/** !
+ * Pop a value off a shared stack
+ * 
+ * @param p_shared_stack the shared stack
+ * @param ret            result, or null
+ * 
+ * @sa shared_stack_push
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int shared_stack_pop ( shared_stack *const p_shared_stack, void **const ret );
+
+/** !
+ * Peek the top of a shared stack
+ * 
+ * @param p_shared_stack the shared stack
+ * @param ret            result
+ * 
+ * @sa shared_stack_pop
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int shared_stack_peek ( shared_stack *const p_shared_stack, void **const ret );
+
+/** !
+ * Destroy a shared stack's lock. Call once, after every other process is 
+ * done with the stack. The caller unmaps the shared memory
+ * 
+ * @param pp_shared_stack pointer to shared stack pointer
+ * 
+ * @sa shared_stack_construct
+ * 
+ * @return 1 on success, 0 on error
+*/
+DLLEXPORT int shared_stack_destroy ( shared_stack **const pp_shared_stack );
+#endif
+
 // Cleanup
 /** !
- * This gets called at runtime after main
+ * This gets called at runtime after main. Does nothing if the library was 
+ * never initialized
  * 
  * @param void
  * 
@@ -0,0 +1,380 @@
+/** !
+ * Header only C++ interface for stack library
+ *
+ * @file stack/stack.hpp
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace stk
+{
+
+    // Lock policies. Any type with lock() and unlock() will do
+    namespace lock
+    {
+
+        /** !
+         * No synchronization. For stacks owned by a single thread
+         */
+        struct unsynchronized
+        {
+            void lock   ( void ) noexcept { }
+            void unlock ( void ) noexcept { }
+        };
+
+        /** !
+         * Busy wait on an atomic flag. For short critical sections that
+         * should never enter the kernel
+         */
+        class spin
+        {
+            public:
+                void lock ( void ) noexcept
+                {
+
+                    // Spin until the flag is clear
+                    while ( _flag.test_and_set(std::memory_order_acquire) );
+                }
+
+                void unlock ( void ) noexcept
+                {
+
+                    // Clear the flag
+                    _flag.clear(std::memory_order_release);
+                }
+
+            private:
+                std::atomic_flag _flag = ATOMIC_FLAG_INIT;
+        };
+
+        /** !
+         * Block on a mutex
+         */
+        using locked = std::mutex;
+    }
+
+    namespace detail
+    {
+
+        /** !
+         * Storage for a fixed quantity of elements, inside the stack
+         */
+        template <typename T, std::size_t Capacity>
+        class storage
+        {
+            public:
+                explicit storage ( std::size_t ) noexcept { }
+
+                storage ( storage && ) noexcept { }
+
+                T *data ( void ) noexcept { return std::launder(reinterpret_cast<T *>(_p_data)); }
+                const T *data ( void ) const noexcept { return std::launder(reinterpret_cast<const T *>(_p_data)); }
+
+                constexpr std::size_t capacity ( void ) const noexcept { return Capacity; }
+
+                // The elements are moved one at a time
+                static constexpr bool steals = false;
+
+                void swap ( storage & ) noexcept { }
+
+            private:
+                alignas(T) unsigned char _p_data[Capacity * sizeof(T)];
+        };
+
+        /** !
+         * Storage for a quantity of elements chosen at runtime, on the heap
+         */
+        template <typename T>
+        class storage<T, 0>
+        {
+            public:
+                explicit storage ( std::size_t capacity )
+                    : _p_data(static_cast<T *>(::operator new(capacity * sizeof(T), std::align_val_t(alignof(T))))),
+                      _capacity(capacity)
+                { }
+
+                storage ( storage &&other ) noexcept
+                    : _p_data(std::exchange(other._p_data, nullptr)),
+                      _capacity(std::exchange(other._capacity, 0))
+                { }
+
+                ~storage ( void )
+                {
+
+                    // Free the elements
+                    if ( _p_data ) ::operator delete(_p_data, std::align_val_t(alignof(T)));
+                }
+
+                T *data ( void ) noexcept { return _p_data; }
+                const T *data ( void ) const noexcept { return _p_data; }
+
+                std::size_t capacity ( void ) const noexcept { return _capacity; }
+
+                // The whole buffer changes hands
+                static constexpr bool steals = true;
+
+                void swap ( storage &other ) noexcept
+                {
+                    std::swap(_p_data, other._p_data);
+                    std::swap(_capacity, other._capacity);
+                }
+
+            private:
+                T           *_p_data;
+                std::size_t  _capacity;
+        };
+    }
+
+    /** !
+     * A stack of T. Everything is inline, so the compiler can see through
+     * every call in a hot loop
+     *
+     * @tparam T          the element type
+     * @tparam LockPolicy lock::locked, lock::spin, lock::unsynchronized, or any type with lock() and unlock()
+     * @tparam Capacity   the quantity of elements stored inside the stack, or 0 to choose at runtime
+     */
+    template <typename T, typename LockPolicy = lock::locked, std::size_t Capacity = 0>
+    class stack
+    {
+        public:
+
+            // Constructors
+            /** !
+             * Construct an empty stack of Capacity elements
+             */
+            template <std::size_t C = Capacity, std::enable_if_t<C != 0, int> = 0>
+            stack ( void )
+                : _storage(Capacity)
+            { }
+
+            /** !
+             * Construct an empty stack. Only if Capacity is 0
+             *
+             * @param capacity the quantity of elements
+             */
+            template <std::size_t C = Capacity, std::enable_if_t<C == 0, int> = 0>
+            explicit stack ( std::size_t capacity )
+                : _storage(capacity)
+            { }
+
+            stack ( const stack & ) = delete;
+            stack &operator= ( const stack & ) = delete;
+
+            /** !
+             * Take the elements of another stack. Not thread safe
+             */
+            stack ( stack &&other ) noexcept(std::is_nothrow_move_constructible_v<T>)
+                : _storage(std::move(other._storage))
+            {
+
+                // Take the buffer
+                if constexpr ( decltype(_storage)::steals )
+                    _size = std::exchange(other._size, 0);
+
+                // Move each element
+                else
+                    other.move_into(*this);
+            }
+
+            /** !
+             * Destroy this stack's elements, and take the elements of another
+             * stack. Not thread safe
+             */
+            stack &operator= ( stack &&other ) noexcept(std::is_nothrow_move_constructible_v<T>)
+            {
+
+                // Self assignment
+                if ( this == &other ) return *this;
+
+                // Destroy the elements
+                destroy();
+
+                // Take the buffer
+                if constexpr ( decltype(_storage)::steals )
+                {
+                    _storage.swap(other._storage);
+                    _size = std::exchange(other._size, 0);
+                }
+
+                // Move each element
+                else
+                    other.move_into(*this);
+
+                // Done
+                return *this;
+            }
+
+            // Destructors
+            ~stack ( void ) { destroy(); }
+
+            // Mutators
+            /** !
+             * Construct a value on top of the stack
+             *
+             * @param args the arguments to T's constructor
+             *
+             * @return true on success, false if the stack is full
+             */
+            template <typename... Args>
+            bool emplace ( Args &&...args )
+            {
+
+                // Lock
+                std::lock_guard<LockPolicy> guard(_lock);
+
+                // Error checking
+                if ( _size == _storage.capacity() ) return false;
+
+                // Construct the value in place
+                ::new (static_cast<void *>(_storage.data() + _size)) T(std::forward<Args>(args)...);
+
+                // Push the value
+                _size++;
+
+                // Success
+                return true;
+            }
+
+            /** !
+             * Push a value onto the stack
+             *
+             * @param value the value
+             *
+             * @return true on success, false if the stack is full
+             */
+            bool push ( const T &value ) { return emplace(value); }
+            bool push ( T &&value ) { return emplace(std::move(value)); }
+
+            /** !
+             * Pop a value off the stack
+             *
+             * @return the value, or nothing if the stack is empty
+             */
+            std::optional<T> try_pop ( void )
+            {
+
+                // Lock
+                std::lock_guard<LockPolicy> guard(_lock);
+
+                // Error checking
+                if ( _size == 0 ) return std::nullopt;
+
+                // Initialized data. If the move throws, the stack is unchanged
+                T                *p_top  = _storage.data() + _size - 1;
+                std::optional<T>  result(std::move(*p_top));
+
+                // Destroy the moved from value
+                p_top->~T();
+
+                // Pop the value
+                _size--;
+
+                // Success
+                return result;
+            }
+
+            /** !
+             * Destroy every value on the stack
+             */
+            void clear ( void )
+            {
+
+                // Lock
+                std::lock_guard<LockPolicy> guard(_lock);
+
+                // Destroy the elements
+                destroy();
+            }
+
+            // Accessors
+            /** !
+             * Copy the top of the stack
+             *
+             * @return the value, or nothing if the stack is empty
+             */
+            std::optional<T> try_peek ( void ) const
+            {
+
+                // Lock
+                std::lock_guard<LockPolicy> guard(_lock);
+
+                // Error checking
+                if ( _size == 0 ) return std::nullopt;
+
+                // Success
+                return _storage.data()[_size - 1];
+            }
+
+            std::size_t size ( void ) const
+            {
+
+                // Lock
+                std::lock_guard<LockPolicy> guard(_lock);
+
+                // Success
+                return _size;
+            }
+
+            bool empty ( void ) const { return size() == 0; }
+
+            std::size_t capacity ( void ) const noexcept { return _storage.capacity(); }
+
+        private:
+            detail::storage<T, Capacity>  _storage;
+            std::size_t                   _size = 0;
+            mutable LockPolicy            _lock;
+
+            /** !
+             * Destroy every element. Call with the stack locked
+             */
+            void destroy ( void ) noexcept
+            {
+
+                // Destroy from the top down
+                if constexpr ( !std::is_trivially_destructible_v<T> )
+                    while ( _size ) _storage.data()[--_size].~T();
+
+                // Nothing to destroy
+                else
+                    _size = 0;
+            }
+
+            /** !
+             * Move every element into an empty stack, then destroy them here.
+             * If a move throws, the other stack is left empty and this stack
+             * keeps its elements
+             */
+            void move_into ( stack &other )
+            {
+
+                // Move from the bottom up, counting each element as it is built
+                try
+                {
+                    for (; other._size < _size; other._size++)
+                        ::new (static_cast<void *>(other._storage.data() + other._size)) T(std::move(_storage.data()[other._size]));
+                }
+
+                // Destroy the elements that were built
+                catch ( ... )
+                {
+                    other.destroy();
+                    throw;
+                }
+
+                // Destroy the moved from values
+                destroy();
+            }
+    };
+}
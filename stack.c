@@ -6,18 +6,218 @@
  * @author Jacob Smith
  */
 
+// Feature test macros
+#ifdef __linux__
+	#ifndef _GNU_SOURCE
+		#define _GNU_SOURCE
+	#endif
+#endif
+
 // Header
 #include <stack/stack.h>
 
+// log submodule
+#ifndef STACK_NO_LOG
+	#include <log/log.h>
+#else
+	#define log_error(...) ((void) 0)
+#endif
+
+// Atomics
+#include <stdatomic.h>
+
+// Standard library
+#include <stddef.h>
+#include <stdint.h>
+
+// Process shared locks
+#ifdef __linux__
+	#include <errno.h>
+	#include <pthread.h>
+#endif
+
+// Tracepoints
+#ifdef STACK_TRACEPOINTS
+	#define _SDT_HAS_SEMAPHORES 1
+	#include <sys/sdt.h>
+#endif
+
+// Yield
+#ifdef _WIN64
+	#include <windows.h>
+	#define STACK_YIELD() SwitchToThread()
+#else
+	#include <sched.h>
+	#define STACK_YIELD() sched_yield()
+#endif
+
+// Bit scan
+#ifdef _MSC_VER
+	#include <intrin.h>
+#endif
+
+// Vector extensions
+#if UINTPTR_MAX == UINT64_MAX && defined(__AVX2__)
+	#define STACK_SEARCH_AVX2
+	#include <immintrin.h>
+#elif UINTPTR_MAX == UINT64_MAX && ( defined(__SSE2__) || defined(_M_X64) )
+	#define STACK_SEARCH_SSE2
+	#include <emmintrin.h>
+#endif
+
+// eventfd
+#ifdef __linux__
+	#include <unistd.h>
+	#include <sys/eventfd.h>
+#endif
+
 // Structures
 struct stack_s
 {
 	size_t      size;      // The quantity of elements that could fit in the stack
 	size_t      offset;    // The quantity of elements in the stack
 	mutex       _lock;     // Locked when reading/writing values
+
+	struct
+	{
+		int    fd;        // Readable when the stack becomes non-empty, or -1 if notifications are disabled
+		size_t threshold; // Also signal when the quantity of elements falls below this value, or 0
+	} _notify;
+
+	struct
+	{
+		fn_stack_combine  *pfn_combine; // Combines two values, or null if the stack is not augmented
+		const void       **_p_data;     // The aggregate of each element and every element beneath it
+	} _aggregate;
+
+	struct
+	{
+		size_t              high;          // Call the watermark function when the quantity of elements rises to this value
+		size_t              low;           // Call the watermark function when the quantity of elements falls to this value
+		bool                above;         // Set when the high watermark is reached, cleared when the low watermark is reached
+		fn_stack_watermark *pfn_watermark; // Called on each crossing, or null if watermarks are disabled
+	} _watermark;
+
 	const void *_p_data[]; // The stack elements
 };
 
+struct record_stack_s
+{
+	size_t   size;     // The quantity of bytes that could fit in the stack
+	size_t   offset;   // The quantity of bytes in the stack
+	size_t   count;    // The quantity of records in the stack
+	size_t   reserved; // The quantity of bytes reserved by an uncommitted push
+	mutex    _lock;    // Locked when reading/writing values, and between reserve and commit
+	_Atomic(const char *) p_reserver; // The thread that holds the reservation, or null
+	_Alignas(max_align_t) unsigned char _p_data[]; // The records
+};
+
+struct stack_arena_s
+{
+	size_t size;   // The quantity of bytes that could be allocated from the arena
+	size_t offset; // The quantity of bytes allocated from the arena
+	mutex  _lock;  // Locked when allocating and releasing
+	_Alignas(max_align_t) unsigned char _p_data[]; // The arena
+};
+
+struct pool_stack_s
+{
+	size_t      offset;    // The quantity of elements in the stack
+	const void *_p_data[]; // The stack elements, or the next free stack if released
+};
+
+struct stack_slab_s
+{
+	struct stack_slab_s *p_next; // The next slab
+	size_t               used;   // The quantity of stacks carved from the slab
+	_Alignas(max_align_t) unsigned char _p_data[]; // The stacks
+};
+
+struct stack_pool_s
+{
+	size_t               size;        // The quantity of elements that could fit in each stack
+	size_t               stride;      // The quantity of bytes between stacks in a slab
+	size_t               slab_stacks; // The quantity of stacks in each slab
+	size_t               stripes;     // The quantity of striped locks
+	pool_stack          *p_free;      // Released stacks
+	struct stack_slab_s *p_slabs;     // The slabs, newest first
+	mutex                _lock;       // Locked when acquiring and releasing stacks
+	mutex                _p_stripes[]; // Locked when reading/writing values, shared by stacks with the same hash
+};
+
+struct priority_stack_s
+{
+	size_t      levels;         // The quantity of priority levels
+	size_t      size;           // The quantity of elements that could fit in each level
+	uint64_t    bitmap;         // Bit N is set if level N is not empty
+	size_t      _offsets[64];   // The quantity of elements in each level
+	mutex       _lock;          // Locked when reading/writing values
+	const void *_p_data[];      // The elements of level N start at N * size
+};
+
+struct ring_stack_s
+{
+	size_t      size;      // The quantity of elements that could fit in the stack
+	size_t      bottom;    // The index of the bottom element
+	size_t      count;     // The quantity of elements in the stack
+	size_t      evictions; // The quantity of elements evicted by pushes at capacity
+	mutex       _lock;     // Locked when reading/writing values
+	const void *_p_data[]; // The stack elements, wrapping around
+};
+
+struct mru_node_s
+{
+	const void *p_value; // The element
+	size_t      hash;    // The hash of the element
+	size_t      above;   // The node above, or SIZE_MAX if this is the top
+	size_t      below;   // The node below, or SIZE_MAX if this is the bottom. The next free node if free
+};
+
+struct mru_stack_s
+{
+	size_t             size;       // The quantity of elements that could fit in the stack
+	size_t             count;      // The quantity of elements in the stack
+	size_t             top;        // The most recently used node, or SIZE_MAX if empty
+	size_t             bottom;     // The least recently used node, or SIZE_MAX if empty
+	size_t             free;       // The first free node, or SIZE_MAX if full
+	size_t             mask;       // The quantity of index slots, less one
+	fn_stack_hash     *pfn_hash;   // Hashes an element, or null to hash the address
+	fn_stack_equal    *pfn_equal;  // Compares two elements, or null to compare addresses
+	mutex              _lock;      // Locked when reading/writing values
+	size_t            *_p_slots;   // Open addressing index of nodes, SIZE_MAX if the slot is empty
+	struct mru_node_s  _p_nodes[]; // The nodes, followed by the index
+};
+
+struct intrusive_stack_s
+{
+	stack_node *p_top;    // The top node, or null if empty
+	stack_node *p_bottom; // The bottom node, or null if empty
+	mutex       _lock;    // Locked when reading/writing nodes
+};
+
+struct lockfree_stack_s
+{
+	_Atomic uint64_t top; // The top node, tagged with a count of updates
+};
+
+#ifdef __linux__
+struct shared_stack_s
+{
+	uint64_t        magic;     // Identifies an initialized shared stack
+	size_t          size;      // The quantity of elements that could fit in the stack
+	size_t          offset;    // The quantity of elements in the stack
+	pthread_mutex_t _lock;     // Process shared, robust lock. Locked when reading/writing values
+	ptrdiff_t       _p_data[]; // The stack elements, relative to the address of the stack
+};
+#endif
+
+// Each record is followed by a trailer, so records can be popped without an index
+struct record_trailer_s
+{
+	size_t previous; // The offset of the stack before the record was pushed
+	size_t length;   // The quantity of bytes in the record
+};
+
 // Forward declarations
 /** !
  * Allocate memory for a stack
@@ -30,23 +230,218 @@ struct stack_s
 */
 DLLEXPORT int stack_create ( stack **const pp_stack );
 
+/** !
+ * Signal a stack's notification file descriptor, and call its watermark 
+ * function, if the quantity of elements crossed an edge. Call with the 
+ * stack locked.
+ * 
+ * @param p_stack the stack
+ * @param before  the quantity of elements before the operation
+ * @param after   the quantity of elements after the operation
+ * 
+ * @return void
+ */
+static void stack_notify ( stack *const p_stack, size_t before, size_t after );
+
+/** !
+ * Move elements from the top of one stack to the top of another, preserving 
+ * their order. Call with both stacks locked
+ * 
+ * @param p_destination the destination stack
+ * @param p_source      the source stack
+ * @param count         the quantity of elements to move
+ * 
+ * @return void
+ */
+static void stack_move ( stack *const p_destination, stack *const p_source, size_t count );
+
+/** !
+ * Find the topmost occurrence of a value in an array of elements
+ * 
+ * @param p_data  the elements, bottom first
+ * @param count   the quantity of elements
+ * @param p_value the value
+ * 
+ * @return the index of the value from the bottom, or SIZE_MAX if not found
+ */
+static size_t stack_search ( const void *const *const p_data, size_t count, const void *const p_value );
+
+/** !
+ * Get the striped lock that guards a pooled stack
+ * 
+ * @param p_stack_pool the stack pool
+ * @param p_pool_stack the pooled stack
+ * 
+ * @return the lock
+ */
+static mutex *stack_pool_stripe ( stack_pool *const p_stack_pool, const pool_stack *const p_pool_stack );
+
+/** !
+ * Find the most significant set bit of a non-zero bitmap
+ * 
+ * @param bitmap the bitmap
+ * 
+ * @return the index of the bit
+ */
+static size_t stack_highest_bit ( uint64_t bitmap );
+
+/** !
+ * Hash an element of an MRU stack
+ * 
+ * @param p_mru_stack the MRU stack
+ * @param p_value     the element
+ * 
+ * @return the hash
+ */
+static size_t mru_stack_hash ( const mru_stack *const p_mru_stack, const void *const p_value );
+
+/** !
+ * Look up an element of an MRU stack by linear probing. Call with the stack locked
+ * 
+ * @param p_mru_stack the MRU stack
+ * @param p_value     the element
+ * @param hash        the hash of the element
+ * @param p_slot      result, the slot of the element, or the empty slot that ended the probe
+ * 
+ * @return the node of the element, or SIZE_MAX if not found
+ */
+static size_t mru_stack_find ( const mru_stack *const p_mru_stack, const void *const p_value, size_t hash, size_t *const p_slot );
+
+/** !
+ * Detach a node from the list of an MRU stack. Call with the stack locked
+ * 
+ * @param p_mru_stack the MRU stack
+ * @param node        the node
+ * 
+ * @return void
+ */
+static void mru_stack_unlink ( mru_stack *const p_mru_stack, size_t node );
+
+/** !
+ * Attach a node to the top of the list of an MRU stack. Call with the stack locked
+ * 
+ * @param p_mru_stack the MRU stack
+ * @param node        the node
+ * 
+ * @return void
+ */
+static void mru_stack_link ( mru_stack *const p_mru_stack, size_t node );
+
+/** !
+ * Remove a node from the index and the list of an MRU stack, and free it.
+ * Call with the stack locked
+ * 
+ * @param p_mru_stack the MRU stack
+ * @param node        the node
+ * 
+ * @return the element
+ */
+static const void *mru_stack_take ( mru_stack *const p_mru_stack, size_t node );
+
+#ifdef __linux__
+/** !
+ * Lock a shared stack. If the previous owner died while holding the lock, 
+ * the lock is recovered. Stack operations are ordered so that the stack is
+ * consistent at every instruction
+ * 
+ * @param p_shared_stack the shared stack
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int shared_stack_lock ( shared_stack *const p_shared_stack );
+#endif
+
+// Preprocessor macros
+#define STACK_ALIGN_UP(x, a) ( ( (x) + ( (a) - 1 ) ) & ~( (size_t)(a) - 1 ) )
+#define STACK_WRAP(i, n)     ( ( (i) >= (n) ) ? (i) - (n) : (i) )
+#define SHARED_STACK_MAGIC   0x4B43415453444853ULL // "SHDSTACK"
+
+// Tagged pointers. On 64 bit targets, user space addresses fit in the low 
+// 48 bits, so the tag takes the high 16. On 32 bit targets, the tag takes 
+// the high 32 bits of a 64 bit word
+#if UINTPTR_MAX > 0xFFFFFFFFu
+	#define STACK_TAG_SHIFT 48
+#else
+	#define STACK_TAG_SHIFT 32
+#endif
+#define STACK_TAG_PACK(p, tag) ( (uint64_t)(uintptr_t)(p) | ( (uint64_t)(tag) << STACK_TAG_SHIFT ) )
+#define STACK_TAG_POINTER(v)   ( (stack_node *)(uintptr_t)( (v) & ( ( 1ULL << STACK_TAG_SHIFT ) - 1 ) ) )
+#define STACK_TAG_NEXT(v)      ( ( (v) >> STACK_TAG_SHIFT ) + 1 )
+
+// A pop may read the link of a node that another thread is pushing back. The
+// compare exchange discards what it read, but the access itself must be atomic
+#ifdef _MSC_VER
+	#define STACK_NEXT_LOAD(p_node)     ( (p_node)->p_next )
+	#define STACK_NEXT_STORE(p_node, v) ( (p_node)->p_next = (v) )
+#else
+	#define STACK_NEXT_LOAD(p_node)     __atomic_load_n(&(p_node)->p_next, __ATOMIC_RELAXED)
+	#define STACK_NEXT_STORE(p_node, v) __atomic_store_n(&(p_node)->p_next, (v), __ATOMIC_RELAXED)
+#endif
+
+// Static tracepoints. Each probe has a semaphore, which is non-zero while a 
+// tracer like perf or bpftrace is attached, so the lock wait is only timed on demand
+#ifdef STACK_TRACEPOINTS
+	#define STACK_TRACE_SEMAPHORE(name) __attribute__((used, section(".probes"))) static volatile unsigned short stack_##name##_semaphore
+	#define STACK_TRACE(name, ...)      STAP_PROBEV(stack, name, __VA_ARGS__)
+	#define STACK_LOCK(p_stack)                                                          \
+		do                                                                               \
+		{                                                                                \
+			if ( __builtin_expect(stack_lock_semaphore, 0) )                             \
+			{                                                                            \
+				timestamp _t0 = timer_high_precision();                                  \
+				mutex_lock(&(p_stack)->_lock);                                           \
+				STACK_TRACE(lock, (p_stack), timer_high_precision() - _t0);              \
+			}                                                                            \
+			else                                                                         \
+				mutex_lock(&(p_stack)->_lock);                                           \
+		} while (0)
+
+	STACK_TRACE_SEMAPHORE(push);
+	STACK_TRACE_SEMAPHORE(pop);
+	STACK_TRACE_SEMAPHORE(peek);
+	STACK_TRACE_SEMAPHORE(overflow);
+	STACK_TRACE_SEMAPHORE(underflow);
+	STACK_TRACE_SEMAPHORE(lock);
+#else
+	#define STACK_TRACE(name, ...) ((void) 0)
+	#define STACK_LOCK(p_stack)    mutex_lock(&(p_stack)->_lock)
+#endif
+
 // Data
-static bool initialized = false;
+static atomic_int initialized = 0; // 0 if uninitialized, 1 while initializing, 2 if initialized
+static _Thread_local char stack_thread;  // The address identifies the calling thread
 
 void stack_init ( void )
 {
 
-    // State check
-    if ( initialized == true ) return;
+    // Initialized data
+    int expected = 0;
+
+    // Fast exit
+    if ( atomic_load_explicit(&initialized, memory_order_acquire) == 2 ) return;
+
+    // Another thread is initializing the library
+    if ( atomic_compare_exchange_strong(&initialized, &expected, 1) == false )
+    {
+
+        // Wait for it, giving up the processor between checks
+        while ( atomic_load_explicit(&initialized, memory_order_acquire) != 2 )
+            STACK_YIELD();
+
+        // Done
+        return;
+    }
 
     // Initialize the log library
-    log_init();
+    #ifndef STACK_NO_LOG
+        log_init();
+    #endif
 
     // Initialize the sync library
     sync_init();
 
     // Set the initialized flag
-    initialized = true;
+    atomic_store_explicit(&initialized, 2, memory_order_release);
 
     // Done
     return;
@@ -103,6 +498,9 @@ int stack_create ( stack **const pp_stack )
 int stack_construct ( stack **const pp_stack, size_t size )
 {
 
+	// Initialize the library
+	stack_init();
+
 	// Argument check
 	if ( pp_stack == (void *) 0 ) goto no_stack;
 	if ( size < 1 ) goto no_size;
@@ -122,6 +520,9 @@ int stack_construct ( stack **const pp_stack, size_t size )
 	// Set the size
 	p_stack->size = size;
 
+	// Notifications are disabled by default
+	p_stack->_notify.fd = -1;
+
 	// Create a mutex
     if ( mutex_create(&p_stack->_lock) == 0 ) goto failed_to_mutex_create;
 
@@ -186,6 +587,83 @@ int stack_construct ( stack **const pp_stack, size_t size )
 	}
 }
 
+int stack_construct_augmented ( stack **const pp_stack, size_t size, fn_stack_combine *pfn_combine )
+{
+
+	// Argument check
+	if ( pp_stack    == (void *) 0 ) goto no_stack;
+	if ( pfn_combine == (void *) 0 ) goto no_combine;
+
+	// Initialized data
+	stack *p_stack = 0;
+
+	// Construct a stack
+	if ( stack_construct(&p_stack, size) == 0 ) goto failed_to_construct_stack;
+
+	// Allocate memory for the aggregates
+	p_stack->_aggregate._p_data = STACK_REALLOC(0, size * sizeof(void *));
+
+	// Error check
+	if ( p_stack->_aggregate._p_data == (void *) 0 ) goto no_mem;
+
+	// Store the combine function
+	p_stack->_aggregate.pfn_combine = pfn_combine;
+
+	// Return a pointer to the caller
+	*pp_stack = p_stack;
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_combine:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pfn_combine\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// stack errors
+		{
+			failed_to_construct_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Failed to construct stack in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// Standard library errors
+		{
+			no_mem:
+				#ifndef NDEBUG
+					log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Free the stack
+				stack_destroy(&p_stack);
+
+				// Error
+				return 0;
+		}
+	}
+}
+
 int stack_push ( stack *const p_stack, const void *const p_value )
 {
 
@@ -197,11 +675,21 @@ int stack_push ( stack *const p_stack, const void *const p_value )
 	if ( p_stack->size == p_stack->offset ) goto stack_overflow;
 
 	// Lock
-    mutex_lock(&p_stack->_lock);
+	STACK_LOCK(p_stack);
+
+	// Update the running aggregate
+	if ( p_stack->_aggregate.pfn_combine )
+		p_stack->_aggregate._p_data[p_stack->offset] = ( p_stack->offset ) ? p_stack->_aggregate.pfn_combine(p_stack->_aggregate._p_data[p_stack->offset-1], p_value) : p_value;
 
 	// Push the data onto the stack
 	p_stack->_p_data[p_stack->offset++] = p_value;
 
+	// Signal the empty to non-empty edge
+	stack_notify(p_stack, p_stack->offset - 1, p_stack->offset);
+
+	// Trace
+	STACK_TRACE(push, p_stack, p_value, p_stack->offset);
+
 	// Unlock
     mutex_unlock(&p_stack->_lock);
 
@@ -234,6 +722,10 @@ int stack_push ( stack *const p_stack, const void *const p_value )
 		// stack errors
 		{
 			stack_overflow:
+
+				// Trace
+				STACK_TRACE(overflow, p_stack, p_value);
+
 				#ifndef NDEBUG
 					log_error("[stack] Stack overflow!\n");
 				#endif
@@ -254,7 +746,7 @@ int stack_pop ( stack *const p_stack, const void **const ret )
 	if ( p_stack->offset < 1 ) goto stack_underflow;
 
 	// Lock
-	mutex_lock(&p_stack->_lock);
+	STACK_LOCK(p_stack);
 
 	// Return the value to the caller
 	if ( ret )
@@ -266,6 +758,12 @@ int stack_pop ( stack *const p_stack, const void **const ret )
 	else
 		--p_stack->offset;
 
+	// Signal the threshold edge
+	stack_notify(p_stack, p_stack->offset + 1, p_stack->offset);
+
+	// Trace
+	STACK_TRACE(pop, p_stack, p_stack->_p_data[p_stack->offset], p_stack->offset);
+
 	// Unlock
 	mutex_unlock(&p_stack->_lock);
 
@@ -278,6 +776,10 @@ int stack_pop ( stack *const p_stack, const void **const ret )
 		// stack errors
 		{
 			stack_underflow:
+
+				// Trace
+				STACK_TRACE(underflow, p_stack);
+
 				#ifndef NDEBUG
 					log_error("[stack] Stack Underflow!\n");
 				#endif
@@ -310,10 +812,13 @@ int stack_peek ( stack *const p_stack, const void **const ret )
 	if ( p_stack->offset < 1 ) goto stack_underflow;
 
 	// Lock
-	mutex_lock(&p_stack->_lock);
+	STACK_LOCK(p_stack);
 
 	// Peek the stack and write the return
 	*ret = p_stack->_p_data[p_stack->offset-1];
+
+	// Trace
+	STACK_TRACE(peek, p_stack, *ret);
 	
 	// Unlock
 	mutex_unlock(&p_stack->_lock);
@@ -327,6 +832,10 @@ int stack_peek ( stack *const p_stack, const void **const ret )
 		// stack errors
 		{
 			stack_underflow:
+
+				// Trace
+				STACK_TRACE(underflow, p_stack);
+
 				#ifndef NDEBUG
 					log_error("[stack] Stack Underflow!\n");
 				#endif
@@ -356,32 +865,27 @@ int stack_peek ( stack *const p_stack, const void **const ret )
 	}
 }
 
-int stack_destroy ( stack **const pp_stack )
+int stack_aggregate ( stack *const p_stack, const void **const ret )
 {
 
 	// Argument check
-	if ( pp_stack == (void *) 0 ) goto no_stack;
-
-	// Initialized data
-	stack *p_stack = *pp_stack;
+	if ( p_stack == (void *) 0 ) goto no_stack;
+	if ( ret     == (void *) 0 ) goto no_ret;
 
-	// Error checking
-	if ( p_stack == (void *) 0 ) goto pointer_to_null_pointer;
+	// State check
+	if ( p_stack->_aggregate.pfn_combine == (void *) 0 ) goto not_augmented;
 
 	// Lock
-    mutex_lock(&p_stack->_lock);
+	STACK_LOCK(p_stack);
 
-	// No more pointer for caller
-	*pp_stack = 0;
+	// Error checking
+	if ( p_stack->offset < 1 ) goto stack_underflow;
 
-	// Unlock
-    mutex_unlock(&p_stack->_lock);
+	// Write the aggregate of the whole stack
+	*ret = p_stack->_aggregate._p_data[p_stack->offset-1];
 
-	// Destroy the mutex
-    mutex_destroy(&p_stack->_lock);
-	
-	// Free the stack
-	p_stack = STACK_REALLOC(p_stack, 0);
+	// Unlock
+	mutex_unlock(&p_stack->_lock);
 
 	// Success
 	return 1;
@@ -389,19 +893,42 @@ int stack_destroy ( stack **const pp_stack )
 	// Error handling
 	{
 
+		// stack errors
+		{
+			not_augmented:
+				#ifndef NDEBUG
+					log_error("[stack] Stack is not augmented in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			stack_underflow:
+
+				// Unlock
+				mutex_unlock(&p_stack->_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Stack Underflow!\n");
+				#endif
+
+				// Error
+				return 0;
+		}
+
 		// Argument errors
 		{
 			no_stack:
 				#ifndef NDEBUG
-					log_error("[stack] Null pointer provided for \"pp_stack\" in call to function \"%s\"\n", __FUNCTION__);
+					log_error("[stack] Null pointer provided for \"p_stack\" in call to function \"%s\"\n", __FUNCTION__);
 				#endif
 
 				// Error
 				return 0;
 
-			pointer_to_null_pointer:
+			no_ret:
 				#ifndef NDEBUG
-					log_error("[stack] Parameter \"pp_stack\" points to null pointer in call to function \"%s\"\n", __FUNCTION__);
+					log_error("[stack] Null pointer provided for \"ret\" in call to function \"%s\"\n", __FUNCTION__);
 				#endif
 
 				// Error
@@ -410,20 +937,5061 @@ int stack_destroy ( stack **const pp_stack )
 	}
 }
 
+int stack_count ( stack *const p_stack, size_t *const p_count )
+{
+
+	// Argument check
+	if ( p_stack == (void *) 0 ) goto no_stack;
+	if ( p_count == (void *) 0 ) goto no_count;
+
+	// Lock
+	STACK_LOCK(p_stack);
+
+	// Return the quantity of elements to the caller
+	*p_count = p_stack->offset;
+
+	// Unlock
+	mutex_unlock(&p_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_count:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_count\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int stack_get ( stack *const p_stack, size_t index, const void **const ret )
+{
+
+	// Argument check
+	if ( p_stack == (void *) 0 ) goto no_stack;
+	if ( ret     == (void *) 0 ) goto no_ret;
+
+	// Lock
+	STACK_LOCK(p_stack);
+
+	// Error checking
+	if ( index >= p_stack->offset ) goto out_of_bounds;
+
+	// Write the element
+	*ret = p_stack->_p_data[p_stack->offset - 1 - index];
+
+	// Unlock
+	mutex_unlock(&p_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// stack errors
+		{
+			out_of_bounds:
+
+				// Unlock
+				mutex_unlock(&p_stack->_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"index\" is out of bounds in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// Argument errors
+		{
+			no_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_ret:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"ret\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int stack_frame_get ( stack *const p_stack, size_t frame, size_t index, const void **const ret )
+{
+
+	// Argument check
+	if ( p_stack == (void *) 0 ) goto no_stack;
+	if ( ret     == (void *) 0 ) goto no_ret;
+
+	// Lock
+	STACK_LOCK(p_stack);
+
+	// Error checking
+	if ( frame + index >= p_stack->offset || frame + index < frame ) goto out_of_bounds;
+
+	// Write the element
+	*ret = p_stack->_p_data[frame + index];
+
+	// Unlock
+	mutex_unlock(&p_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// stack errors
+		{
+			out_of_bounds:
+
+				// Unlock
+				mutex_unlock(&p_stack->_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"index\" is out of bounds in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// Argument errors
+		{
+			no_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_ret:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"ret\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int stack_find ( stack *const p_stack, const void *const p_value, size_t *const p_index )
+{
+
+	// Argument check
+	if ( p_stack == (void *) 0 ) goto no_stack;
+
+	// Initialized data
+	size_t i = 0;
+
+	// Lock
+	STACK_LOCK(p_stack);
+
+	// Search the stack
+	i = stack_search(p_stack->_p_data, p_stack->offset, p_value);
+
+	// Return the index from the top to the caller
+	if ( i != SIZE_MAX && p_index ) *p_index = p_stack->offset - 1 - i;
+
+	// Unlock
+	mutex_unlock(&p_stack->_lock);
+
+	// Success
+	return ( i != SIZE_MAX );
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int stack_contains ( stack *const p_stack, const void *const p_value )
+{
+
+	// Success
+	return stack_find(p_stack, p_value, (void *) 0);
+}
+
+int stack_for_each ( stack *const p_stack, fn_stack_for_each *pfn_for_each )
+{
+
+	// Argument check
+	if ( p_stack      == (void *) 0 ) goto no_stack;
+	if ( pfn_for_each == (void *) 0 ) goto no_for_each;
+
+	// Lock
+	STACK_LOCK(p_stack);
+
+	// Iterate from top to bottom
+	for (size_t i = 0; i < p_stack->offset; i++)
+		pfn_for_each(p_stack->_p_data[p_stack->offset - 1 - i], i);
+
+	// Unlock
+	mutex_unlock(&p_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_for_each:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pfn_for_each\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int stack_for_each_reverse ( stack *const p_stack, fn_stack_for_each *pfn_for_each )
+{
+
+	// Argument check
+	if ( p_stack      == (void *) 0 ) goto no_stack;
+	if ( pfn_for_each == (void *) 0 ) goto no_for_each;
+
+	// Lock
+	STACK_LOCK(p_stack);
+
+	// Iterate from bottom to top
+	for (size_t i = p_stack->offset; i-- > 0;)
+		pfn_for_each(p_stack->_p_data[p_stack->offset - 1 - i], i);
+
+	// Unlock
+	mutex_unlock(&p_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_for_each:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pfn_for_each\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+static size_t stack_search ( const void *const *const p_data, size_t count, const void *const p_value )
+{
+
+	// Initialized data
+	size_t i = count;
+
+	#if defined(STACK_SEARCH_AVX2)
+
+		// Initialized data
+		__m256i key = _mm256_set1_epi64x((long long)(uintptr_t)p_value);
+
+		// Compare four elements at a time, from the top down
+		for (; i >= 4; i -= 4)
+		{
+
+			// Initialized data
+			__m256i block = _mm256_loadu_si256((const __m256i *)&p_data[i - 4]);
+			int     mask  = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(block, key)));
+
+			// Return the topmost match in the block
+			if ( mask ) 
+				for (size_t j = 4; j-- > 0;)
+					if ( mask & ( 1 << j ) ) return i - 4 + j;
+		}
+	#elif defined(STACK_SEARCH_SSE2)
+
+		// Initialized data
+		__m128i key = _mm_set1_epi64x((long long)(uintptr_t)p_value);
+
+		// Compare two elements at a time, from the top down
+		for (; i >= 2; i -= 2)
+		{
+
+			// Initialized data
+			__m128i block = _mm_loadu_si128((const __m128i *)&p_data[i - 2]),
+			        half  = _mm_cmpeq_epi32(block, key);
+			int     mask  = 0;
+
+			// SSE2 has no 64-bit compare, so both halves of an element must match
+			half = _mm_and_si128(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(2, 3, 0, 1)));
+			mask = _mm_movemask_pd(_mm_castsi128_pd(half));
+
+			// Return the topmost match in the block
+			if ( mask ) return ( mask & 2 ) ? i - 1 : i - 2;
+		}
+	#endif
+
+	// Compare the remaining elements
+	while ( i-- > 0 )
+		if ( p_data[i] == p_value ) return i;
+
+	// Not found
+	return SIZE_MAX;
+}
+
+int stack_frame_push ( stack *const p_stack, size_t *const p_frame )
+{
+
+	// Argument check
+	if ( p_stack == (void *) 0 ) goto no_stack;
+	if ( p_frame == (void *) 0 ) goto no_frame;
+
+	// Lock
+	STACK_LOCK(p_stack);
+
+	// The frame starts at the top of the stack
+	*p_frame = p_stack->offset;
+
+	// Unlock
+	mutex_unlock(&p_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_frame:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_frame\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int stack_frame_pop ( stack *const p_stack, size_t frame )
+{
+
+	// Argument check
+	if ( p_stack == (void *) 0 ) goto no_stack;
+
+	// Initialized data
+	size_t before = 0;
+
+	// Lock
+	STACK_LOCK(p_stack);
+
+	// Error checking
+	if ( frame > p_stack->offset ) goto stack_underflow;
+
+	// Discard every element in the frame
+	before          = p_stack->offset;
+	p_stack->offset = frame;
+
+	// Signal the threshold edge
+	stack_notify(p_stack, before, p_stack->offset);
+
+	// Unlock
+	mutex_unlock(&p_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// stack errors
+		{
+			stack_underflow:
+
+				// Unlock
+				mutex_unlock(&p_stack->_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Stack Underflow!\n");
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// Argument errors
+		{
+			no_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int stack_drain ( stack *const p_stack, const void **const p_values, size_t capacity, size_t *const p_count )
+{
+
+	// Argument check
+	if ( p_stack  == (void *) 0 ) goto no_stack;
+	if ( p_values == (void *) 0 ) goto no_values;
+	if ( p_count  == (void *) 0 ) goto no_count;
+
+	// Initialized data
+	size_t before = 0,
+	       count  = 0;
+
+	// Lock
+	STACK_LOCK(p_stack);
+
+	// Take everything, or as much as fits
+	before = p_stack->offset;
+	count  = ( before < capacity ) ? before : capacity;
+
+	// Copy the elements
+	memcpy(p_values, &p_stack->_p_data[before - count], count * sizeof(void *));
+
+	// Empty the stack
+	p_stack->offset = before - count;
+
+	// Signal the threshold edge
+	stack_notify(p_stack, before, p_stack->offset);
+
+	// Unlock
+	mutex_unlock(&p_stack->_lock);
+
+	// Return the quantity of elements to the caller
+	*p_count = count;
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_values:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_values\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_count:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_count\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int stack_splice ( stack *const p_destination, stack *const p_source, size_t count )
+{
+
+	// Argument check
+	if ( p_destination == (void *) 0 ) goto no_destination;
+	if ( p_source      == (void *) 0 ) goto no_source;
+	if ( p_destination == p_source   ) goto same_stack;
+
+	// Initialized data
+	stack *p_first  = ( p_destination < p_source ) ? p_destination : p_source,
+	      *p_second = ( p_destination < p_source ) ? p_source : p_destination;
+
+	// Lock both stacks, in address order
+	STACK_LOCK(p_first);
+	STACK_LOCK(p_second);
+
+	// Error checking
+	if ( count > p_source->offset ) goto stack_underflow;
+	if ( count > p_destination->size - p_destination->offset ) goto stack_overflow;
+
+	// Move the elements
+	stack_move(p_destination, p_source, count);
+
+	// Unlock
+	mutex_unlock(&p_second->_lock);
+	mutex_unlock(&p_first->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_destination:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_destination\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_source:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_source\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			same_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Parameters \"p_destination\" and \"p_source\" are the same stack in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// stack errors
+		{
+			stack_underflow:
+
+				// Unlock
+				mutex_unlock(&p_second->_lock);
+				mutex_unlock(&p_first->_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Stack Underflow!\n");
+				#endif
+
+				// Error
+				return 0;
+
+			stack_overflow:
+
+				// Unlock
+				mutex_unlock(&p_second->_lock);
+				mutex_unlock(&p_first->_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Stack overflow!\n");
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int stack_steal_half ( stack *const p_destination, stack *const p_source, size_t *const p_count )
+{
+
+	// Argument check
+	if ( p_destination == (void *) 0 ) goto no_destination;
+	if ( p_source      == (void *) 0 ) goto no_source;
+	if ( p_destination == p_source   ) goto same_stack;
+
+	// Initialized data
+	stack  *p_first  = ( p_destination < p_source ) ? p_destination : p_source,
+	       *p_second = ( p_destination < p_source ) ? p_source : p_destination;
+	size_t  count    = 0,
+	        space    = 0;
+
+	// Lock both stacks, in address order
+	STACK_LOCK(p_first);
+	STACK_LOCK(p_second);
+
+	// Take the top half of the source, rounded up, if it fits
+	count = ( p_source->offset + 1 ) / 2;
+	space = p_destination->size - p_destination->offset;
+	if ( count > space ) count = space;
+
+	// Move the elements
+	stack_move(p_destination, p_source, count);
+
+	// Unlock
+	mutex_unlock(&p_second->_lock);
+	mutex_unlock(&p_first->_lock);
+
+	// Return the quantity of elements to the caller
+	if ( p_count ) *p_count = count;
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_destination:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_destination\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_source:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_source\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			same_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Parameters \"p_destination\" and \"p_source\" are the same stack in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int stack_clone ( stack *const p_stack, stack **const pp_clone )
+{
+
+	// Argument check
+	if ( p_stack  == (void *) 0 ) goto no_stack;
+	if ( pp_clone == (void *) 0 ) goto no_clone;
+
+	// Initialized data
+	stack *p_clone = 0;
+
+	// Construct a stack of the same kind
+	if ( p_stack->_aggregate.pfn_combine )
+	{
+		if ( stack_construct_augmented(&p_clone, p_stack->size, p_stack->_aggregate.pfn_combine) == 0 ) goto failed_to_construct_stack;
+	}
+	else
+	{
+		if ( stack_construct(&p_clone, p_stack->size) == 0 ) goto failed_to_construct_stack;
+	}
+
+	// Lock
+	STACK_LOCK(p_stack);
+
+	// Copy the elements
+	memcpy(p_clone->_p_data, p_stack->_p_data, p_stack->offset * sizeof(void *));
+
+	// Copy the aggregates
+	if ( p_stack->_aggregate.pfn_combine )
+		memcpy(p_clone->_aggregate._p_data, p_stack->_aggregate._p_data, p_stack->offset * sizeof(void *));
+
+	// Copy the quantity of elements
+	p_clone->offset = p_stack->offset;
+
+	// Unlock
+	mutex_unlock(&p_stack->_lock);
+
+	// Return a pointer to the caller
+	*pp_clone = p_clone;
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_clone:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_clone\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// stack errors
+		{
+			failed_to_construct_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Failed to construct stack in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+static void stack_move ( stack *const p_destination, stack *const p_source, size_t count )
+{
+
+	// Initialized data
+	size_t destination_offset = p_destination->offset,
+	       source_offset      = p_source->offset;
+
+	// Fast exit
+	if ( count == 0 ) return;
+
+	// Copy the elements
+	memcpy(&p_destination->_p_data[destination_offset], &p_source->_p_data[source_offset - count], count * sizeof(void *));
+
+	// Update the running aggregate
+	if ( p_destination->_aggregate.pfn_combine )
+		for (size_t i = destination_offset; i < destination_offset + count; i++)
+			p_destination->_aggregate._p_data[i] = ( i ) ? p_destination->_aggregate.pfn_combine(p_destination->_aggregate._p_data[i-1], p_destination->_p_data[i]) : p_destination->_p_data[i];
+
+	// Update the quantity of elements
+	p_destination->offset += count;
+	p_source->offset      -= count;
+
+	// Signal edges
+	stack_notify(p_destination, destination_offset, p_destination->offset);
+	stack_notify(p_source, source_offset, p_source->offset);
+
+	// Done
+	return;
+}
+
+int stack_watermark_set ( stack *const p_stack, size_t high, size_t low, fn_stack_watermark *pfn_watermark )
+{
+
+	// Argument check
+	if ( p_stack == (void *) 0 ) goto no_stack;
+	if ( pfn_watermark && ( low >= high || high > p_stack->size ) ) goto bad_watermarks;
+
+	// Lock
+	STACK_LOCK(p_stack);
+
+	// Store the watermarks
+	p_stack->_watermark.high          = high;
+	p_stack->_watermark.low           = low;
+	p_stack->_watermark.pfn_watermark = pfn_watermark;
+
+	// Start above the high watermark, if the stack is already that full
+	p_stack->_watermark.above = ( pfn_watermark && p_stack->offset >= high );
+
+	// Unlock
+	mutex_unlock(&p_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			bad_watermarks:
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"low\" must be less than \"high\", and \"high\" must not exceed the size of the stack in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int stack_notify_enable ( stack *const p_stack, size_t threshold, int *const p_fd )
+{
+
+	// Argument check
+	if ( p_stack == (void *) 0 ) goto no_stack;
+	if ( p_fd    == (void *) 0 ) goto no_fd;
+
+	// Platform check
+	#ifndef __linux__
+		goto not_supported;
+	#else
+
+	// Lock
+	STACK_LOCK(p_stack);
+
+	// Create an event file descriptor, if notifications are not already enabled
+	if ( p_stack->_notify.fd == -1 )
+	{
+		
+		// Initialized data
+		int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+		// Error check
+		if ( fd == -1 ) goto failed_to_create_eventfd;
+
+		// Store the file descriptor
+		p_stack->_notify.fd = fd;
+
+		// A non-empty stack is already ready
+		if ( p_stack->offset ) eventfd_write(fd, 1);
+	}
+
+	// Set the threshold
+	p_stack->_notify.threshold = threshold;
+
+	// Return the file descriptor to the caller
+	*p_fd = p_stack->_notify.fd;
+
+	// Unlock
+	mutex_unlock(&p_stack->_lock);
+
+	// Success
+	return 1;
+	#endif
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_fd:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_fd\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// Platform errors
+		{
+			#ifndef __linux__
+			not_supported:
+				#ifndef NDEBUG
+					log_error("[stack] Notifications are not supported on this platform in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+			#else
+			failed_to_create_eventfd:
+
+				// Unlock
+				mutex_unlock(&p_stack->_lock);
+
+				#ifndef NDEBUG
+					log_error("[Standard Library] Failed to create eventfd in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+			#endif
+		}
+	}
+}
+
+int stack_notify_disable ( stack *const p_stack )
+{
+
+	// Argument check
+	if ( p_stack == (void *) 0 ) goto no_stack;
+
+	// Lock
+	STACK_LOCK(p_stack);
+
+	// Close the event file descriptor
+	#ifdef __linux__
+		if ( p_stack->_notify.fd != -1 ) close(p_stack->_notify.fd);
+	#endif
+
+	// Disable notifications
+	p_stack->_notify.fd        = -1;
+	p_stack->_notify.threshold = 0;
+
+	// Unlock
+	mutex_unlock(&p_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+static void stack_notify ( stack *const p_stack, size_t before, size_t after )
+{
+
+	// Watermarks
+	if ( p_stack->_watermark.pfn_watermark )
+	{
+
+		// Rose to the high watermark
+		if ( p_stack->_watermark.above == false && after >= p_stack->_watermark.high )
+		{
+			p_stack->_watermark.above = true;
+			p_stack->_watermark.pfn_watermark(p_stack, true);
+		}
+
+		// Fell to the low watermark
+		else if ( p_stack->_watermark.above == true && after <= p_stack->_watermark.low )
+		{
+			p_stack->_watermark.above = false;
+			p_stack->_watermark.pfn_watermark(p_stack, false);
+		}
+	}
+
+	// Fast exit
+	if ( p_stack->_notify.fd == -1 ) return;
+
+	#ifdef __linux__
+
+		// Empty to non-empty
+		if ( before == 0 && after > 0 ) goto signal;
+
+		// Fell below the threshold
+		if ( before >= p_stack->_notify.threshold && after < p_stack->_notify.threshold ) goto signal;
+
+		// No edge
+		return;
+
+		// Make the file descriptor readable
+		signal:
+			eventfd_write(p_stack->_notify.fd, 1);
+	#else
+
+		// Suppress compiler warnings
+		(void) before;
+		(void) after;
+	#endif
+
+	// Done
+	return;
+}
+
+int stack_destroy ( stack **const pp_stack )
+{
+
+	// Argument check
+	if ( pp_stack == (void *) 0 ) goto no_stack;
+
+	// Initialized data
+	stack *p_stack = *pp_stack;
+
+	// Error checking
+	if ( p_stack == (void *) 0 ) goto pointer_to_null_pointer;
+
+	// Lock
+    STACK_LOCK(p_stack);
+
+	// No more pointer for caller
+	*pp_stack = 0;
+
+	// Close the notification file descriptor
+	#ifdef __linux__
+		if ( p_stack->_notify.fd != -1 ) close(p_stack->_notify.fd);
+	#endif
+
+	// Unlock
+    mutex_unlock(&p_stack->_lock);
+
+	// Destroy the mutex
+    mutex_destroy(&p_stack->_lock);
+
+	// Free the aggregates
+	if ( p_stack->_aggregate._p_data ) p_stack->_aggregate._p_data = STACK_REALLOC(p_stack->_aggregate._p_data, 0);
+	
+	// Free the stack
+	p_stack = STACK_REALLOC(p_stack, 0);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			pointer_to_null_pointer:
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"pp_stack\" points to null pointer in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int record_stack_construct ( record_stack **const pp_record_stack, size_t size )
+{
+
+	// Initialize the library
+	stack_init();
+
+	// Argument check
+	if ( pp_record_stack == (void *) 0 ) goto no_record_stack;
+	if ( size < 1 ) goto no_size;
+	if ( size > SIZE_MAX - sizeof(record_stack) ) goto too_large;
+
+	// Initialized data
+	record_stack *p_record_stack = STACK_REALLOC(0, sizeof(record_stack) + size);
+
+	// Error check
+	if ( p_record_stack == (void *) 0 ) goto no_mem;
+
+	// Zero set
+	memset(p_record_stack, 0, sizeof(record_stack));
+
+	// Set the size
+	p_record_stack->size = size;
+
+	// Create a mutex
+	if ( mutex_create(&p_record_stack->_lock) == 0 ) goto failed_to_mutex_create;
+
+	// Return a pointer to the caller
+	*pp_record_stack = p_record_stack;
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_record_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_record_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_size:
+				#ifndef NDEBUG
+					log_error("[stack] No size provided in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			too_large:
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"size\" is too large in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// sync errors
+		{
+			failed_to_mutex_create:
+				#ifndef NDEBUG
+					log_error("[stack] Failed to create mutex in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Free the record stack
+				p_record_stack = STACK_REALLOC(p_record_stack, 0);
+
+				// Error
+				return 0;
+		}
+
+		// Standard library errors
+		{
+			no_mem:
+				#ifndef NDEBUG
+					log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int record_stack_reserve ( record_stack *const p_record_stack, size_t size, void **const pp_data )
+{
+
+	// Argument check
+	if ( p_record_stack == (void *) 0 ) goto no_record_stack;
+	if ( pp_data        == (void *) 0 ) goto no_data;
+
+	// State check
+	if ( atomic_load_explicit(&p_record_stack->p_reserver, memory_order_relaxed) == &stack_thread ) goto already_reserved;
+
+	// Lock
+	mutex_lock(&p_record_stack->_lock);
+
+	// Initialized data
+	size_t start = STACK_ALIGN_UP(p_record_stack->offset, _Alignof(max_align_t)),
+	       end   = 0;
+
+	// Error checking. Compare before adding, so a huge size can't wrap around
+	if ( start > p_record_stack->size || size > p_record_stack->size - start ) goto stack_overflow;
+
+	// Compute the end of the trailer
+	end = STACK_ALIGN_UP(start + size, _Alignof(struct record_trailer_s)) + sizeof(struct record_trailer_s);
+
+	// Error checking
+	if ( end > p_record_stack->size ) goto stack_overflow;
+
+	// Store the reservation
+	p_record_stack->reserved = size;
+	atomic_store_explicit(&p_record_stack->p_reserver, &stack_thread, memory_order_relaxed);
+
+	// Return a pointer to the caller
+	*pp_data = &p_record_stack->_p_data[start];
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_record_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_record_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_data:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_data\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// stack errors
+		{
+			already_reserved:
+				#ifndef NDEBUG
+					log_error("[stack] A reservation is already open in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			stack_overflow:
+
+				// Unlock
+				mutex_unlock(&p_record_stack->_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Stack overflow!\n");
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int record_stack_commit ( record_stack *const p_record_stack, size_t size )
+{
+
+	// Argument check
+	if ( p_record_stack == (void *) 0 ) goto no_record_stack;
+
+	// State check
+	if ( atomic_load_explicit(&p_record_stack->p_reserver, memory_order_relaxed) != &stack_thread ) goto no_reservation;
+
+	// Error checking
+	if ( size > p_record_stack->reserved ) goto too_large;
+
+	// Initialized data
+	size_t                   start     = STACK_ALIGN_UP(p_record_stack->offset, _Alignof(max_align_t)),
+	                         trailer   = STACK_ALIGN_UP(start + size, _Alignof(struct record_trailer_s));
+	struct record_trailer_s *p_trailer = (struct record_trailer_s *) &p_record_stack->_p_data[trailer];
+
+	// Write the trailer
+	*p_trailer = (struct record_trailer_s)
+	{
+		.previous = p_record_stack->offset,
+		.length   = size
+	};
+
+	// Push the record
+	p_record_stack->offset   = trailer + sizeof(struct record_trailer_s);
+	p_record_stack->reserved = 0;
+	p_record_stack->count++;
+
+	// Close the reservation
+	atomic_store_explicit(&p_record_stack->p_reserver, (const char *) 0, memory_order_relaxed);
+
+	// Unlock
+	mutex_unlock(&p_record_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_record_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_record_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			too_large:
+
+				// Drop the reservation, and unlock
+				record_stack_cancel(p_record_stack);
+
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"size\" exceeds the reservation in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// stack errors
+		{
+			no_reservation:
+				#ifndef NDEBUG
+					log_error("[stack] No reservation is open in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int record_stack_cancel ( record_stack *const p_record_stack )
+{
+
+	// Argument check
+	if ( p_record_stack == (void *) 0 ) goto no_record_stack;
+
+	// State check
+	if ( atomic_load_explicit(&p_record_stack->p_reserver, memory_order_relaxed) != &stack_thread ) goto no_reservation;
+
+	// Drop the reservation
+	p_record_stack->reserved = 0;
+	atomic_store_explicit(&p_record_stack->p_reserver, (const char *) 0, memory_order_relaxed);
+
+	// Unlock
+	mutex_unlock(&p_record_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_record_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_record_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// stack errors
+		{
+			no_reservation:
+				#ifndef NDEBUG
+					log_error("[stack] No reservation is open in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int record_stack_push ( record_stack *const p_record_stack, const void *const p_data, size_t size )
+{
+
+	// Argument check
+	if ( p_data == (void *) 0 && size ) goto no_data;
+
+	// Initialized data
+	void *p_record = 0;
+
+	// Reserve space for the record
+	if ( record_stack_reserve(p_record_stack, size, &p_record) == 0 ) goto failed_to_reserve;
+
+	// Copy the record
+	if ( size ) memcpy(p_record, p_data, size);
+
+	// Commit the record
+	return record_stack_commit(p_record_stack, size);
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_data:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_data\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// stack errors
+		{
+			failed_to_reserve:
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int record_stack_pop ( record_stack *const p_record_stack, const void **const pp_data, size_t *const p_size )
+{
+
+	// Argument check
+	if ( p_record_stack == (void *) 0 ) goto no_record_stack;
+
+	// Lock
+	mutex_lock(&p_record_stack->_lock);
+
+	// Error checking
+	if ( p_record_stack->count < 1 ) goto stack_underflow;
+
+	// Initialized data
+	struct record_trailer_s *p_trailer = (struct record_trailer_s *) &p_record_stack->_p_data[p_record_stack->offset - sizeof(struct record_trailer_s)];
+
+	// Return a view of the record to the caller
+	if ( pp_data ) *pp_data = &p_record_stack->_p_data[STACK_ALIGN_UP(p_trailer->previous, _Alignof(max_align_t))];
+	if ( p_size  ) *p_size  = p_trailer->length;
+
+	// Pop the record
+	p_record_stack->offset = p_trailer->previous;
+	p_record_stack->count--;
+
+	// Unlock
+	mutex_unlock(&p_record_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// stack errors
+		{
+			stack_underflow:
+
+				// Unlock
+				mutex_unlock(&p_record_stack->_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Stack Underflow!\n");
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// Argument errors
+		{
+			no_record_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_record_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int record_stack_peek ( record_stack *const p_record_stack, const void **const pp_data, size_t *const p_size )
+{
+
+	// Argument check
+	if ( p_record_stack == (void *) 0 ) goto no_record_stack;
+	if ( pp_data        == (void *) 0 ) goto no_data;
+
+	// Lock
+	mutex_lock(&p_record_stack->_lock);
+
+	// Error checking
+	if ( p_record_stack->count < 1 ) goto stack_underflow;
+
+	// Initialized data
+	struct record_trailer_s *p_trailer = (struct record_trailer_s *) &p_record_stack->_p_data[p_record_stack->offset - sizeof(struct record_trailer_s)];
+
+	// Return a view of the record to the caller
+	*pp_data = &p_record_stack->_p_data[STACK_ALIGN_UP(p_trailer->previous, _Alignof(max_align_t))];
+	if ( p_size ) *p_size = p_trailer->length;
+
+	// Unlock
+	mutex_unlock(&p_record_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// stack errors
+		{
+			stack_underflow:
+
+				// Unlock
+				mutex_unlock(&p_record_stack->_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Stack Underflow!\n");
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// Argument errors
+		{
+			no_record_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_record_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_data:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_data\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int record_stack_destroy ( record_stack **const pp_record_stack )
+{
+
+	// Argument check
+	if ( pp_record_stack == (void *) 0 ) goto no_record_stack;
+
+	// Initialized data
+	record_stack *p_record_stack = *pp_record_stack;
+
+	// Error checking
+	if ( p_record_stack == (void *) 0 ) goto pointer_to_null_pointer;
+
+	// No more pointer for caller
+	*pp_record_stack = 0;
+
+	// Destroy the mutex
+	mutex_destroy(&p_record_stack->_lock);
+
+	// Free the record stack
+	p_record_stack = STACK_REALLOC(p_record_stack, 0);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_record_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_record_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			pointer_to_null_pointer:
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"pp_record_stack\" points to null pointer in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int stack_arena_construct ( stack_arena **const pp_stack_arena, size_t size )
+{
+
+	// Initialize the library
+	stack_init();
+
+	// Argument check
+	if ( pp_stack_arena == (void *) 0 ) goto no_stack_arena;
+	if ( size < 1 ) goto no_size;
+	if ( size > SIZE_MAX - sizeof(stack_arena) ) goto too_large;
+
+	// Initialized data
+	stack_arena *p_stack_arena = STACK_REALLOC(0, sizeof(stack_arena) + size);
+
+	// Error check
+	if ( p_stack_arena == (void *) 0 ) goto no_mem;
+
+	// Zero set
+	memset(p_stack_arena, 0, sizeof(stack_arena));
+
+	// Set the size
+	p_stack_arena->size = size;
+
+	// Create a mutex
+	if ( mutex_create(&p_stack_arena->_lock) == 0 ) goto failed_to_mutex_create;
+
+	// Return a pointer to the caller
+	*pp_stack_arena = p_stack_arena;
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_stack_arena:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_stack_arena\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_size:
+				#ifndef NDEBUG
+					log_error("[stack] No size provided in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			too_large:
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"size\" is too large in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// sync errors
+		{
+			failed_to_mutex_create:
+				#ifndef NDEBUG
+					log_error("[stack] Failed to create mutex in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Free the arena
+				p_stack_arena = STACK_REALLOC(p_stack_arena, 0);
+
+				// Error
+				return 0;
+		}
+
+		// Standard library errors
+		{
+			no_mem:
+				#ifndef NDEBUG
+					log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int stack_arena_alloc ( stack_arena *const p_stack_arena, size_t size, size_t alignment, void **const pp_block )
+{
+
+	// Argument check
+	if ( p_stack_arena == (void *) 0 ) goto no_stack_arena;
+	if ( pp_block      == (void *) 0 ) goto no_block;
+	if ( alignment & ( alignment - 1 ) ) goto bad_alignment;
+
+	// Default alignment
+	if ( alignment == 0 ) alignment = _Alignof(max_align_t);
+
+	// Lock
+	mutex_lock(&p_stack_arena->_lock);
+
+	// Initialized data
+	uintptr_t base  = (uintptr_t) p_stack_arena->_p_data;
+	size_t    start = STACK_ALIGN_UP(base + p_stack_arena->offset, alignment) - base,
+	          end   = start + size;
+
+	// Error checking
+	if ( end > p_stack_arena->size || end < start ) goto stack_overflow;
+
+	// Bump the offset
+	p_stack_arena->offset = end;
+
+	// Unlock
+	mutex_unlock(&p_stack_arena->_lock);
+
+	// Return a pointer to the caller
+	*pp_block = &p_stack_arena->_p_data[start];
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_stack_arena:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_stack_arena\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_block:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_block\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			bad_alignment:
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"alignment\" must be a power of two in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// stack errors
+		{
+			stack_overflow:
+
+				// Unlock
+				mutex_unlock(&p_stack_arena->_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Stack overflow!\n");
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int stack_arena_mark ( stack_arena *const p_stack_arena, size_t *const p_mark )
+{
+
+	// Argument check
+	if ( p_stack_arena == (void *) 0 ) goto no_stack_arena;
+	if ( p_mark        == (void *) 0 ) goto no_mark;
+
+	// Lock
+	mutex_lock(&p_stack_arena->_lock);
+
+	// Return the mark to the caller
+	*p_mark = p_stack_arena->offset;
+
+	// Unlock
+	mutex_unlock(&p_stack_arena->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_stack_arena:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_stack_arena\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_mark:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_mark\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int stack_arena_release ( stack_arena *const p_stack_arena, size_t mark )
+{
+
+	// Argument check
+	if ( p_stack_arena == (void *) 0 ) goto no_stack_arena;
+
+	// Lock
+	mutex_lock(&p_stack_arena->_lock);
+
+	// Error checking
+	if ( mark > p_stack_arena->offset ) goto bad_mark;
+
+	// Release every block allocated after the mark
+	p_stack_arena->offset = mark;
+
+	// Unlock
+	mutex_unlock(&p_stack_arena->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_stack_arena:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_stack_arena\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// stack errors
+		{
+			bad_mark:
+
+				// Unlock
+				mutex_unlock(&p_stack_arena->_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"mark\" is above the top of the arena in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int stack_arena_destroy ( stack_arena **const pp_stack_arena )
+{
+
+	// Argument check
+	if ( pp_stack_arena == (void *) 0 ) goto no_stack_arena;
+
+	// Initialized data
+	stack_arena *p_stack_arena = *pp_stack_arena;
+
+	// Error checking
+	if ( p_stack_arena == (void *) 0 ) goto pointer_to_null_pointer;
+
+	// No more pointer for caller
+	*pp_stack_arena = 0;
+
+	// Destroy the mutex
+	mutex_destroy(&p_stack_arena->_lock);
+
+	// Free the arena
+	p_stack_arena = STACK_REALLOC(p_stack_arena, 0);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_stack_arena:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_stack_arena\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			pointer_to_null_pointer:
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"pp_stack_arena\" points to null pointer in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int stack_pool_construct ( stack_pool **const pp_stack_pool, size_t size, size_t slab_stacks, size_t stripes )
+{
+
+	// Initialize the library
+	stack_init();
+
+	// Argument check
+	if ( pp_stack_pool == (void *) 0 ) goto no_stack_pool;
+	if ( size        < 1 ) goto no_size;
+	if ( slab_stacks < 1 ) goto no_size;
+	if ( stripes     < 1 ) goto no_size;
+
+	// Error checking. Every size computed from the parameters must fit in a size_t
+	if ( size        > ( SIZE_MAX - sizeof(pool_stack) - _Alignof(pool_stack) ) / sizeof(void *) ) goto too_large;
+	if ( stripes     > ( SIZE_MAX - sizeof(stack_pool) ) / sizeof(mutex) ) goto too_large;
+
+	// Initialized data
+	stack_pool *p_stack_pool = 0;
+	size_t      stride       = STACK_ALIGN_UP(sizeof(pool_stack) + ( size * sizeof(void *) ), _Alignof(pool_stack)),
+	            i            = 0;
+
+	// Error checking. Each slab is allocated on demand, so reject it here
+	if ( slab_stacks > ( SIZE_MAX - sizeof(struct stack_slab_s) ) / stride ) goto too_large;
+
+	// Allocate the stack pool
+	p_stack_pool = STACK_REALLOC(0, sizeof(stack_pool) + ( stripes * sizeof(mutex) ));
+
+	// Error check
+	if ( p_stack_pool == (void *) 0 ) goto no_mem;
+
+	// Zero set
+	memset(p_stack_pool, 0, sizeof(stack_pool));
+
+	// Populate the stack pool
+	p_stack_pool->size        = size;
+	p_stack_pool->stride      = stride;
+	p_stack_pool->slab_stacks = slab_stacks;
+	p_stack_pool->stripes     = stripes;
+
+	// Create a mutex
+	if ( mutex_create(&p_stack_pool->_lock) == 0 ) goto failed_to_mutex_create;
+
+	// Create the striped locks
+	for (i = 0; i < stripes; i++)
+		if ( mutex_create(&p_stack_pool->_p_stripes[i]) == 0 ) goto failed_to_create_stripe;
+
+	// Return a pointer to the caller
+	*pp_stack_pool = p_stack_pool;
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_stack_pool:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_stack_pool\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_size:
+				#ifndef NDEBUG
+					log_error("[stack] No size provided in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			too_large:
+				#ifndef NDEBUG
+					log_error("[stack] The stack pool would be too large in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// sync errors
+		{
+			failed_to_create_stripe:
+
+				// Destroy the striped locks
+				while ( i-- > 0 ) mutex_destroy(&p_stack_pool->_p_stripes[i]);
+
+				// Destroy the mutex
+				mutex_destroy(&p_stack_pool->_lock);
+
+				// Fall through
+
+			failed_to_mutex_create:
+				#ifndef NDEBUG
+					log_error("[stack] Failed to create mutex in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Free the stack pool
+				p_stack_pool = STACK_REALLOC(p_stack_pool, 0);
+
+				// Error
+				return 0;
+		}
+
+		// Standard library errors
+		{
+			no_mem:
+				#ifndef NDEBUG
+					log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int stack_pool_acquire ( stack_pool *const p_stack_pool, pool_stack **const pp_pool_stack )
+{
+
+	// Argument check
+	if ( p_stack_pool  == (void *) 0 ) goto no_stack_pool;
+	if ( pp_pool_stack == (void *) 0 ) goto no_pool_stack;
+
+	// Initialized data
+	pool_stack *p_pool_stack = 0;
+
+	// Lock
+	mutex_lock(&p_stack_pool->_lock);
+
+	// Reuse a released stack
+	if ( p_stack_pool->p_free )
+	{
+		p_pool_stack         = p_stack_pool->p_free;
+		p_stack_pool->p_free = (pool_stack *) p_pool_stack->_p_data[0];
+	}
+
+	// Carve a stack from a slab
+	else
+	{
+
+		// Initialized data
+		struct stack_slab_s *p_slab = p_stack_pool->p_slabs;
+
+		// Allocate a slab, if the newest slab is full
+		if ( p_slab == (void *) 0 || p_slab->used == p_stack_pool->slab_stacks )
+		{
+
+			// Allocate memory for the slab
+			p_slab = STACK_REALLOC(0, sizeof(struct stack_slab_s) + ( p_stack_pool->slab_stacks * p_stack_pool->stride ));
+
+			// Error check
+			if ( p_slab == (void *) 0 ) goto no_mem;
+
+			// Link the slab
+			p_slab->p_next        = p_stack_pool->p_slabs;
+			p_slab->used          = 0;
+			p_stack_pool->p_slabs = p_slab;
+		}
+
+		// Carve the stack
+		p_pool_stack = (pool_stack *) &p_slab->_p_data[p_slab->used++ * p_stack_pool->stride];
+	}
+
+	// Unlock
+	mutex_unlock(&p_stack_pool->_lock);
+
+	// The stack is empty
+	p_pool_stack->offset = 0;
+
+	// Return a pointer to the caller
+	*pp_pool_stack = p_pool_stack;
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_stack_pool:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_stack_pool\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_pool_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_pool_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// Standard library errors
+		{
+			no_mem:
+
+				// Unlock
+				mutex_unlock(&p_stack_pool->_lock);
+
+				#ifndef NDEBUG
+					log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int stack_pool_push ( stack_pool *const p_stack_pool, pool_stack *const p_pool_stack, const void *const p_value )
+{
+
+	// Argument check
+	if ( p_stack_pool == (void *) 0 ) goto no_stack_pool;
+	if ( p_pool_stack == (void *) 0 ) goto no_pool_stack;
+	if ( p_value      == (void *) 0 ) goto no_value;
+
+	// Initialized data
+	mutex *p_lock = stack_pool_stripe(p_stack_pool, p_pool_stack);
+
+	// Lock
+	mutex_lock(p_lock);
+
+	// Error checking
+	if ( p_pool_stack->offset == p_stack_pool->size ) goto stack_overflow;
+
+	// Push the data onto the stack
+	p_pool_stack->_p_data[p_pool_stack->offset++] = p_value;
+
+	// Unlock
+	mutex_unlock(p_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_stack_pool:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_stack_pool\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_pool_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_pool_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_value:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// stack errors
+		{
+			stack_overflow:
+
+				// Unlock
+				mutex_unlock(p_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Stack overflow!\n");
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int stack_pool_pop ( stack_pool *const p_stack_pool, pool_stack *const p_pool_stack, const void **const ret )
+{
+
+	// Argument check
+	if ( p_stack_pool == (void *) 0 ) goto no_stack_pool;
+	if ( p_pool_stack == (void *) 0 ) goto no_pool_stack;
+
+	// Initialized data
+	mutex *p_lock = stack_pool_stripe(p_stack_pool, p_pool_stack);
+
+	// Lock
+	mutex_lock(p_lock);
+
+	// Error checking
+	if ( p_pool_stack->offset < 1 ) goto stack_underflow;
+
+	// Pop the stack
+	--p_pool_stack->offset;
+
+	// Return the value to the caller
+	if ( ret ) *ret = p_pool_stack->_p_data[p_pool_stack->offset];
+
+	// Unlock
+	mutex_unlock(p_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// stack errors
+		{
+			stack_underflow:
+
+				// Unlock
+				mutex_unlock(p_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Stack Underflow!\n");
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// Argument errors
+		{
+			no_stack_pool:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_stack_pool\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_pool_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_pool_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int stack_pool_peek ( stack_pool *const p_stack_pool, pool_stack *const p_pool_stack, const void **const ret )
+{
+
+	// Argument check
+	if ( p_stack_pool == (void *) 0 ) goto no_stack_pool;
+	if ( p_pool_stack == (void *) 0 ) goto no_pool_stack;
+	if ( ret          == (void *) 0 ) goto no_ret;
+
+	// Initialized data
+	mutex *p_lock = stack_pool_stripe(p_stack_pool, p_pool_stack);
+
+	// Lock
+	mutex_lock(p_lock);
+
+	// Error checking
+	if ( p_pool_stack->offset < 1 ) goto stack_underflow;
+
+	// Peek the stack and write the return
+	*ret = p_pool_stack->_p_data[p_pool_stack->offset - 1];
+
+	// Unlock
+	mutex_unlock(p_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// stack errors
+		{
+			stack_underflow:
+
+				// Unlock
+				mutex_unlock(p_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Stack Underflow!\n");
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// Argument errors
+		{
+			no_stack_pool:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_stack_pool\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_pool_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_pool_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_ret:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"ret\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int stack_pool_release ( stack_pool *const p_stack_pool, pool_stack **const pp_pool_stack )
+{
+
+	// Argument check
+	if ( p_stack_pool  == (void *) 0 ) goto no_stack_pool;
+	if ( pp_pool_stack == (void *) 0 ) goto no_pool_stack;
+
+	// Initialized data
+	pool_stack *p_pool_stack = *pp_pool_stack;
+
+	// Error checking
+	if ( p_pool_stack == (void *) 0 ) goto pointer_to_null_pointer;
+
+	// No more pointer for caller
+	*pp_pool_stack = 0;
+
+	// Lock
+	mutex_lock(&p_stack_pool->_lock);
+
+	// Link the stack into the free list
+	p_pool_stack->_p_data[0] = p_stack_pool->p_free;
+	p_stack_pool->p_free     = p_pool_stack;
+
+	// Unlock
+	mutex_unlock(&p_stack_pool->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_stack_pool:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_stack_pool\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_pool_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_pool_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			pointer_to_null_pointer:
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"pp_pool_stack\" points to null pointer in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int stack_pool_destroy ( stack_pool **const pp_stack_pool )
+{
+
+	// Argument check
+	if ( pp_stack_pool == (void *) 0 ) goto no_stack_pool;
+
+	// Initialized data
+	stack_pool          *p_stack_pool = *pp_stack_pool;
+	struct stack_slab_s *p_slab       = 0;
+
+	// Error checking
+	if ( p_stack_pool == (void *) 0 ) goto pointer_to_null_pointer;
+
+	// No more pointer for caller
+	*pp_stack_pool = 0;
+
+	// Free every slab, and every stack carved from it
+	for (p_slab = p_stack_pool->p_slabs; p_slab; )
+	{
+
+		// Initialized data
+		struct stack_slab_s *p_next = p_slab->p_next;
+
+		// Free the slab
+		p_slab = STACK_REALLOC(p_slab, 0);
+
+		// Next
+		p_slab = p_next;
+	}
+
+	// Destroy the striped locks
+	for (size_t i = 0; i < p_stack_pool->stripes; i++)
+		mutex_destroy(&p_stack_pool->_p_stripes[i]);
+
+	// Destroy the mutex
+	mutex_destroy(&p_stack_pool->_lock);
+
+	// Free the stack pool
+	p_stack_pool = STACK_REALLOC(p_stack_pool, 0);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_stack_pool:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_stack_pool\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			pointer_to_null_pointer:
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"pp_stack_pool\" points to null pointer in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+static mutex *stack_pool_stripe ( stack_pool *const p_stack_pool, const pool_stack *const p_pool_stack )
+{
+
+	// Initialized data
+	uint64_t hash = (uint64_t)(uintptr_t) p_pool_stack * 0x9E3779B97F4A7C15ULL;
+
+	// Success
+	return &p_stack_pool->_p_stripes[( hash >> 32 ) % p_stack_pool->stripes];
+}
+
+int priority_stack_construct ( priority_stack **const pp_priority_stack, size_t levels, size_t size )
+{
+
+	// Initialize the library
+	stack_init();
+
+	// Argument check
+	if ( pp_priority_stack == (void *) 0 ) goto no_priority_stack;
+	if ( levels < 1 || levels > 64 ) goto bad_levels;
+	if ( size < 1 ) goto no_size;
+
+	// Error checking. Every level must fit in a size_t
+	if ( size > ( SIZE_MAX - sizeof(priority_stack) ) / sizeof(void *) / levels ) goto too_large;
+
+	// Initialized data
+	priority_stack *p_priority_stack = STACK_REALLOC(0, sizeof(priority_stack) + ( levels * size * sizeof(void *) ));
+
+	// Error check
+	if ( p_priority_stack == (void *) 0 ) goto no_mem;
+
+	// Zero set
+	memset(p_priority_stack, 0, sizeof(priority_stack));
+
+	// Populate the priority stack
+	p_priority_stack->levels = levels;
+	p_priority_stack->size   = size;
+
+	// Create a mutex
+	if ( mutex_create(&p_priority_stack->_lock) == 0 ) goto failed_to_mutex_create;
+
+	// Return a pointer to the caller
+	*pp_priority_stack = p_priority_stack;
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_priority_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_priority_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			bad_levels:
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"levels\" must be between 1 and 64 in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_size:
+				#ifndef NDEBUG
+					log_error("[stack] No size provided in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			too_large:
+				#ifndef NDEBUG
+					log_error("[stack] The priority stack would be too large in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// sync errors
+		{
+			failed_to_mutex_create:
+				#ifndef NDEBUG
+					log_error("[stack] Failed to create mutex in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Free the priority stack
+				p_priority_stack = STACK_REALLOC(p_priority_stack, 0);
+
+				// Error
+				return 0;
+		}
+
+		// Standard library errors
+		{
+			no_mem:
+				#ifndef NDEBUG
+					log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int priority_stack_push ( priority_stack *const p_priority_stack, size_t level, const void *const p_value )
+{
+
+	// Argument check
+	if ( p_priority_stack == (void *) 0 ) goto no_priority_stack;
+	if ( p_value          == (void *) 0 ) goto no_value;
+	if ( level >= p_priority_stack->levels ) goto bad_level;
+
+	// Lock
+	mutex_lock(&p_priority_stack->_lock);
+
+	// Error checking
+	if ( p_priority_stack->_offsets[level] == p_priority_stack->size ) goto stack_overflow;
+
+	// Push the data onto the level
+	p_priority_stack->_p_data[level * p_priority_stack->size + p_priority_stack->_offsets[level]++] = p_value;
+
+	// The level is not empty
+	p_priority_stack->bitmap |= ( 1ULL << level );
+
+	// Unlock
+	mutex_unlock(&p_priority_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_priority_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_priority_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_value:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			bad_level:
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"level\" is out of bounds in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// stack errors
+		{
+			stack_overflow:
+
+				// Unlock
+				mutex_unlock(&p_priority_stack->_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Stack overflow!\n");
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int priority_stack_pop ( priority_stack *const p_priority_stack, const void **const ret, size_t *const p_level )
+{
+
+	// Argument check
+	if ( p_priority_stack == (void *) 0 ) goto no_priority_stack;
+
+	// Initialized data
+	size_t level = 0;
+
+	// Lock
+	mutex_lock(&p_priority_stack->_lock);
+
+	// Error checking
+	if ( p_priority_stack->bitmap == 0 ) goto stack_underflow;
+
+	// Find the highest level that is not empty
+	level = stack_highest_bit(p_priority_stack->bitmap);
+
+	// Pop the level
+	p_priority_stack->_offsets[level]--;
+
+	// Return the value to the caller
+	if ( ret ) *ret = p_priority_stack->_p_data[level * p_priority_stack->size + p_priority_stack->_offsets[level]];
+
+	// The level is empty
+	if ( p_priority_stack->_offsets[level] == 0 ) p_priority_stack->bitmap &= ~( 1ULL << level );
+
+	// Unlock
+	mutex_unlock(&p_priority_stack->_lock);
+
+	// Return the level to the caller
+	if ( p_level ) *p_level = level;
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// stack errors
+		{
+			stack_underflow:
+
+				// Unlock
+				mutex_unlock(&p_priority_stack->_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Stack Underflow!\n");
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// Argument errors
+		{
+			no_priority_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_priority_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int priority_stack_peek ( priority_stack *const p_priority_stack, const void **const ret, size_t *const p_level )
+{
+
+	// Argument check
+	if ( p_priority_stack == (void *) 0 ) goto no_priority_stack;
+	if ( ret              == (void *) 0 ) goto no_ret;
+
+	// Initialized data
+	size_t level = 0;
+
+	// Lock
+	mutex_lock(&p_priority_stack->_lock);
+
+	// Error checking
+	if ( p_priority_stack->bitmap == 0 ) goto stack_underflow;
+
+	// Find the highest level that is not empty
+	level = stack_highest_bit(p_priority_stack->bitmap);
+
+	// Peek the level and write the return
+	*ret = p_priority_stack->_p_data[level * p_priority_stack->size + p_priority_stack->_offsets[level] - 1];
+
+	// Unlock
+	mutex_unlock(&p_priority_stack->_lock);
+
+	// Return the level to the caller
+	if ( p_level ) *p_level = level;
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// stack errors
+		{
+			stack_underflow:
+
+				// Unlock
+				mutex_unlock(&p_priority_stack->_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Stack Underflow!\n");
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// Argument errors
+		{
+			no_priority_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_priority_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_ret:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"ret\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int priority_stack_destroy ( priority_stack **const pp_priority_stack )
+{
+
+	// Argument check
+	if ( pp_priority_stack == (void *) 0 ) goto no_priority_stack;
+
+	// Initialized data
+	priority_stack *p_priority_stack = *pp_priority_stack;
+
+	// Error checking
+	if ( p_priority_stack == (void *) 0 ) goto pointer_to_null_pointer;
+
+	// No more pointer for caller
+	*pp_priority_stack = 0;
+
+	// Destroy the mutex
+	mutex_destroy(&p_priority_stack->_lock);
+
+	// Free the priority stack
+	p_priority_stack = STACK_REALLOC(p_priority_stack, 0);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_priority_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_priority_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			pointer_to_null_pointer:
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"pp_priority_stack\" points to null pointer in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+static size_t stack_highest_bit ( uint64_t bitmap )
+{
+
+	#ifdef _MSC_VER
+
+		// Initialized data
+		unsigned long i = 0;
+
+		// Scan for the most significant set bit
+		_BitScanReverse64(&i, bitmap);
+
+		// Success
+		return (size_t) i;
+	#else
+
+		// Success
+		return (size_t) ( 63 - __builtin_clzll(bitmap) );
+	#endif
+}
+
+int ring_stack_construct ( ring_stack **const pp_ring_stack, size_t size )
+{
+
+	// Initialize the library
+	stack_init();
+
+	// Argument check
+	if ( pp_ring_stack == (void *) 0 ) goto no_ring_stack;
+	if ( size < 1 ) goto no_size;
+	if ( size > ( SIZE_MAX - sizeof(ring_stack) ) / sizeof(void *) ) goto too_large;
+
+	// Initialized data
+	ring_stack *p_ring_stack = STACK_REALLOC(0, sizeof(ring_stack) + ( size * sizeof(void *) ));
+
+	// Error check
+	if ( p_ring_stack == (void *) 0 ) goto no_mem;
+
+	// Zero set
+	memset(p_ring_stack, 0, sizeof(ring_stack));
+
+	// Set the size
+	p_ring_stack->size = size;
+
+	// Create a mutex
+	if ( mutex_create(&p_ring_stack->_lock) == 0 ) goto failed_to_mutex_create;
+
+	// Return a pointer to the caller
+	*pp_ring_stack = p_ring_stack;
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_ring_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_ring_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_size:
+				#ifndef NDEBUG
+					log_error("[stack] No size provided in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			too_large:
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"size\" is too large in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// sync errors
+		{
+			failed_to_mutex_create:
+				#ifndef NDEBUG
+					log_error("[stack] Failed to create mutex in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Free the ring stack
+				p_ring_stack = STACK_REALLOC(p_ring_stack, 0);
+
+				// Error
+				return 0;
+		}
+
+		// Standard library errors
+		{
+			no_mem:
+				#ifndef NDEBUG
+					log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int ring_stack_push ( ring_stack *const p_ring_stack, const void *const p_value, const void **const p_evicted )
+{
+
+	// Argument check
+	if ( p_ring_stack == (void *) 0 ) goto no_ring_stack;
+	if ( p_value      == (void *) 0 ) goto no_value;
+
+	// Initialized data
+	const void *p_bottom = 0;
+
+	// Lock
+	mutex_lock(&p_ring_stack->_lock);
+
+	// At capacity, the new top overwrites the bottom
+	if ( p_ring_stack->count == p_ring_stack->size )
+	{
+
+		// Evict the bottom element
+		p_bottom                 = p_ring_stack->_p_data[p_ring_stack->bottom];
+		p_ring_stack->bottom     = STACK_WRAP(p_ring_stack->bottom + 1, p_ring_stack->size);
+		p_ring_stack->count     -= 1;
+		p_ring_stack->evictions += 1;
+	}
+
+	// Push the data onto the stack
+	p_ring_stack->_p_data[STACK_WRAP(p_ring_stack->bottom + p_ring_stack->count, p_ring_stack->size)] = p_value;
+	p_ring_stack->count++;
+
+	// Unlock
+	mutex_unlock(&p_ring_stack->_lock);
+
+	// Return the evicted value to the caller
+	if ( p_evicted ) *p_evicted = p_bottom;
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_ring_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_ring_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_value:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int ring_stack_pop ( ring_stack *const p_ring_stack, const void **const ret )
+{
+
+	// Argument check
+	if ( p_ring_stack == (void *) 0 ) goto no_ring_stack;
+
+	// Lock
+	mutex_lock(&p_ring_stack->_lock);
+
+	// Error checking
+	if ( p_ring_stack->count < 1 ) goto stack_underflow;
+
+	// Pop the stack
+	p_ring_stack->count--;
+
+	// Return the value to the caller
+	if ( ret ) *ret = p_ring_stack->_p_data[STACK_WRAP(p_ring_stack->bottom + p_ring_stack->count, p_ring_stack->size)];
+
+	// Unlock
+	mutex_unlock(&p_ring_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// stack errors
+		{
+			stack_underflow:
+
+				// Unlock
+				mutex_unlock(&p_ring_stack->_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Stack Underflow!\n");
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// Argument errors
+		{
+			no_ring_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_ring_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int ring_stack_get ( ring_stack *const p_ring_stack, size_t index, const void **const ret )
+{
+
+	// Argument check
+	if ( p_ring_stack == (void *) 0 ) goto no_ring_stack;
+	if ( ret          == (void *) 0 ) goto no_ret;
+
+	// Lock
+	mutex_lock(&p_ring_stack->_lock);
+
+	// Error checking
+	if ( index >= p_ring_stack->count ) goto out_of_bounds;
+
+	// Write the element
+	*ret = p_ring_stack->_p_data[STACK_WRAP(p_ring_stack->bottom + p_ring_stack->count - 1 - index, p_ring_stack->size)];
+
+	// Unlock
+	mutex_unlock(&p_ring_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// stack errors
+		{
+			out_of_bounds:
+
+				// Unlock
+				mutex_unlock(&p_ring_stack->_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"index\" is out of bounds in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// Argument errors
+		{
+			no_ring_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_ring_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_ret:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"ret\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int ring_stack_count ( ring_stack *const p_ring_stack, size_t *const p_count, size_t *const p_evictions )
+{
+
+	// Argument check
+	if ( p_ring_stack == (void *) 0 ) goto no_ring_stack;
+
+	// Lock
+	mutex_lock(&p_ring_stack->_lock);
+
+	// Return the counters to the caller
+	if ( p_count     ) *p_count     = p_ring_stack->count;
+	if ( p_evictions ) *p_evictions = p_ring_stack->evictions;
+
+	// Unlock
+	mutex_unlock(&p_ring_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_ring_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_ring_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int ring_stack_destroy ( ring_stack **const pp_ring_stack )
+{
+
+	// Argument check
+	if ( pp_ring_stack == (void *) 0 ) goto no_ring_stack;
+
+	// Initialized data
+	ring_stack *p_ring_stack = *pp_ring_stack;
+
+	// Error checking
+	if ( p_ring_stack == (void *) 0 ) goto pointer_to_null_pointer;
+
+	// No more pointer for caller
+	*pp_ring_stack = 0;
+
+	// Destroy the mutex
+	mutex_destroy(&p_ring_stack->_lock);
+
+	// Free the ring stack
+	p_ring_stack = STACK_REALLOC(p_ring_stack, 0);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_ring_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_ring_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			pointer_to_null_pointer:
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"pp_ring_stack\" points to null pointer in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int mru_stack_construct ( mru_stack **const pp_mru_stack, size_t size, fn_stack_hash *pfn_hash, fn_stack_equal *pfn_equal )
+{
+
+	// Initialize the library
+	stack_init();
+
+	// Argument check
+	if ( pp_mru_stack == (void *) 0 ) goto no_mru_stack;
+	if ( size < 1 ) goto no_size;
+
+	// Error checking. The index has fewer than 4 slots per element
+	if ( size > ( SIZE_MAX - sizeof(mru_stack) ) / ( sizeof(struct mru_node_s) + ( 4 * sizeof(size_t) ) ) ) goto too_large;
+
+	// Initialized data
+	mru_stack *p_mru_stack = 0;
+	size_t     slots       = 2;
+
+	// Keep the index at most half full, so probe sequences stay short
+	while ( slots < size * 2 ) slots *= 2;
+
+	// Allocate the stack, the nodes, and the index
+	p_mru_stack = STACK_REALLOC(0, sizeof(mru_stack) + ( size * sizeof(struct mru_node_s) ) + ( slots * sizeof(size_t) ));
+
+	// Error check
+	if ( p_mru_stack == (void *) 0 ) goto no_mem;
+
+	// Zero set
+	memset(p_mru_stack, 0, sizeof(mru_stack));
+
+	// Populate the struct
+	p_mru_stack->size      = size;
+	p_mru_stack->mask      = slots - 1;
+	p_mru_stack->top       = SIZE_MAX;
+	p_mru_stack->bottom    = SIZE_MAX;
+	p_mru_stack->free      = 0;
+	p_mru_stack->pfn_hash  = pfn_hash;
+	p_mru_stack->pfn_equal = pfn_equal;
+	p_mru_stack->_p_slots  = (size_t *) &p_mru_stack->_p_nodes[size];
+
+	// Chain every node onto the free list
+	for (size_t i = 0; i < size; i++)
+		p_mru_stack->_p_nodes[i].below = ( i + 1 < size ) ? i + 1 : SIZE_MAX;
+
+	// Empty the index
+	for (size_t i = 0; i < slots; i++)
+		p_mru_stack->_p_slots[i] = SIZE_MAX;
+
+	// Create a mutex
+	if ( mutex_create(&p_mru_stack->_lock) == 0 ) goto failed_to_mutex_create;
+
+	// Return a pointer to the caller
+	*pp_mru_stack = p_mru_stack;
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_mru_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_mru_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_size:
+				#ifndef NDEBUG
+					log_error("[stack] No size provided in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			too_large:
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"size\" is too large in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// sync errors
+		{
+			failed_to_mutex_create:
+				#ifndef NDEBUG
+					log_error("[stack] Failed to create mutex in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Free the MRU stack
+				p_mru_stack = STACK_REALLOC(p_mru_stack, 0);
+
+				// Error
+				return 0;
+		}
+
+		// Standard library errors
+		{
+			no_mem:
+				#ifndef NDEBUG
+					log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int mru_stack_push ( mru_stack *const p_mru_stack, const void *const p_value, const void **const p_evicted )
+{
+
+	// Argument check
+	if ( p_mru_stack == (void *) 0 ) goto no_mru_stack;
+	if ( p_value     == (void *) 0 ) goto no_value;
+
+	// Initialized data
+	const void *p_old = 0;
+	size_t      hash  = mru_stack_hash(p_mru_stack, p_value),
+	            slot  = 0,
+	            node  = 0;
+
+	// Lock
+	mutex_lock(&p_mru_stack->_lock);
+
+	// Look up the value
+	node = mru_stack_find(p_mru_stack, p_value, hash, &slot);
+
+	// The value is present
+	if ( node != SIZE_MAX )
+	{
+
+		// Replace the value
+		p_old                               = p_mru_stack->_p_nodes[node].p_value;
+		p_mru_stack->_p_nodes[node].p_value = p_value;
+
+		// Only hand back a different value
+		if ( p_old == p_value ) p_old = 0;
+
+		// Move it to the top
+		mru_stack_unlink(p_mru_stack, node);
+		mru_stack_link(p_mru_stack, node);
+	}
+
+	// The value is absent
+	else
+	{
+
+		// At capacity, evict the bottom element
+		if ( p_mru_stack->count == p_mru_stack->size )
+		{
+
+			// Take the bottom element
+			p_old = mru_stack_take(p_mru_stack, p_mru_stack->bottom);
+
+			// The eviction may have shifted the empty slot
+			(void) mru_stack_find(p_mru_stack, p_value, hash, &slot);
+		}
+
+		// Take a node off the free list
+		node              = p_mru_stack->free;
+		p_mru_stack->free = p_mru_stack->_p_nodes[node].below;
+
+		// Populate the node
+		p_mru_stack->_p_nodes[node].p_value = p_value;
+		p_mru_stack->_p_nodes[node].hash    = hash;
+
+		// Index the node
+		p_mru_stack->_p_slots[slot] = node;
+
+		// Push the node onto the stack
+		mru_stack_link(p_mru_stack, node);
+		p_mru_stack->count++;
+	}
+
+	// Unlock
+	mutex_unlock(&p_mru_stack->_lock);
+
+	// Return the evicted value to the caller
+	if ( p_evicted ) *p_evicted = p_old;
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_mru_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_mru_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_value:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int mru_stack_touch ( mru_stack *const p_mru_stack, const void *const p_value, const void **const ret )
+{
+
+	// Argument check
+	if ( p_mru_stack == (void *) 0 ) goto no_mru_stack;
+	if ( p_value     == (void *) 0 ) goto no_value;
+
+	// Initialized data
+	size_t hash = mru_stack_hash(p_mru_stack, p_value),
+	       slot = 0,
+	       node = 0;
+
+	// Lock
+	mutex_lock(&p_mru_stack->_lock);
+
+	// Look up the value
+	node = mru_stack_find(p_mru_stack, p_value, hash, &slot);
+
+	// Move it to the top
+	if ( node != SIZE_MAX )
+	{
+		mru_stack_unlink(p_mru_stack, node);
+		mru_stack_link(p_mru_stack, node);
+
+		// Return the value to the caller
+		if ( ret ) *ret = p_mru_stack->_p_nodes[node].p_value;
+	}
+
+	// Unlock
+	mutex_unlock(&p_mru_stack->_lock);
+
+	// Success
+	return ( node != SIZE_MAX );
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_mru_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_mru_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_value:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int mru_stack_remove ( mru_stack *const p_mru_stack, const void *const p_value, const void **const ret )
+{
+
+	// Argument check
+	if ( p_mru_stack == (void *) 0 ) goto no_mru_stack;
+	if ( p_value     == (void *) 0 ) goto no_value;
+
+	// Initialized data
+	const void *p_old = 0;
+	size_t      hash  = mru_stack_hash(p_mru_stack, p_value),
+	            slot  = 0,
+	            node  = 0;
+
+	// Lock
+	mutex_lock(&p_mru_stack->_lock);
+
+	// Look up the value
+	node = mru_stack_find(p_mru_stack, p_value, hash, &slot);
+
+	// Remove it
+	if ( node != SIZE_MAX ) p_old = mru_stack_take(p_mru_stack, node);
+
+	// Unlock
+	mutex_unlock(&p_mru_stack->_lock);
+
+	// Return the value to the caller
+	if ( node != SIZE_MAX && ret ) *ret = p_old;
+
+	// Success
+	return ( node != SIZE_MAX );
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_mru_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_mru_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_value:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int mru_stack_pop ( mru_stack *const p_mru_stack, const void **const ret )
+{
+
+	// Argument check
+	if ( p_mru_stack == (void *) 0 ) goto no_mru_stack;
+
+	// Initialized data
+	const void *p_value = 0;
+
+	// Lock
+	mutex_lock(&p_mru_stack->_lock);
+
+	// Error checking
+	if ( p_mru_stack->count < 1 ) goto stack_underflow;
+
+	// Take the top element
+	p_value = mru_stack_take(p_mru_stack, p_mru_stack->top);
+
+	// Unlock
+	mutex_unlock(&p_mru_stack->_lock);
+
+	// Return the value to the caller
+	if ( ret ) *ret = p_value;
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// stack errors
+		{
+			stack_underflow:
+
+				// Unlock
+				mutex_unlock(&p_mru_stack->_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Stack Underflow!\n");
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// Argument errors
+		{
+			no_mru_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_mru_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int mru_stack_pop_bottom ( mru_stack *const p_mru_stack, const void **const ret )
+{
+
+	// Argument check
+	if ( p_mru_stack == (void *) 0 ) goto no_mru_stack;
+
+	// Initialized data
+	const void *p_value = 0;
+
+	// Lock
+	mutex_lock(&p_mru_stack->_lock);
+
+	// Error checking
+	if ( p_mru_stack->count < 1 ) goto stack_underflow;
+
+	// Take the bottom element
+	p_value = mru_stack_take(p_mru_stack, p_mru_stack->bottom);
+
+	// Unlock
+	mutex_unlock(&p_mru_stack->_lock);
+
+	// Return the value to the caller
+	if ( ret ) *ret = p_value;
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// stack errors
+		{
+			stack_underflow:
+
+				// Unlock
+				mutex_unlock(&p_mru_stack->_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Stack Underflow!\n");
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// Argument errors
+		{
+			no_mru_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_mru_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int mru_stack_peek ( mru_stack *const p_mru_stack, const void **const ret )
+{
+
+	// Argument check
+	if ( p_mru_stack == (void *) 0 ) goto no_mru_stack;
+	if ( ret         == (void *) 0 ) goto no_ret;
+
+	// Lock
+	mutex_lock(&p_mru_stack->_lock);
+
+	// Error checking
+	if ( p_mru_stack->count < 1 ) goto stack_underflow;
+
+	// Return the value to the caller
+	*ret = p_mru_stack->_p_nodes[p_mru_stack->top].p_value;
+
+	// Unlock
+	mutex_unlock(&p_mru_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// stack errors
+		{
+			stack_underflow:
+
+				// Unlock
+				mutex_unlock(&p_mru_stack->_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Stack Underflow!\n");
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// Argument errors
+		{
+			no_mru_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_mru_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_ret:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"ret\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int mru_stack_count ( mru_stack *const p_mru_stack, size_t *const p_count )
+{
+
+	// Argument check
+	if ( p_mru_stack == (void *) 0 ) goto no_mru_stack;
+	if ( p_count     == (void *) 0 ) goto no_count;
+
+	// Lock
+	mutex_lock(&p_mru_stack->_lock);
+
+	// Return the quantity of elements to the caller
+	*p_count = p_mru_stack->count;
+
+	// Unlock
+	mutex_unlock(&p_mru_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_mru_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_mru_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_count:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_count\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int mru_stack_destroy ( mru_stack **const pp_mru_stack )
+{
+
+	// Argument check
+	if ( pp_mru_stack == (void *) 0 ) goto no_mru_stack;
+
+	// Initialized data
+	mru_stack *p_mru_stack = *pp_mru_stack;
+
+	// Error checking
+	if ( p_mru_stack == (void *) 0 ) goto pointer_to_null_pointer;
+
+	// No more pointer for caller
+	*pp_mru_stack = 0;
+
+	// Destroy the mutex
+	mutex_destroy(&p_mru_stack->_lock);
+
+	// Free the MRU stack
+	p_mru_stack = STACK_REALLOC(p_mru_stack, 0);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_mru_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_mru_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			pointer_to_null_pointer:
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"pp_mru_stack\" points to null pointer in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+static size_t mru_stack_hash ( const mru_stack *const p_mru_stack, const void *const p_value )
+{
+
+	// Custom hash
+	if ( p_mru_stack->pfn_hash ) return p_mru_stack->pfn_hash(p_value);
+
+	// Fibonacci hash of the address. The high bits are the well mixed ones
+	return (size_t) ( ( (uint64_t)(uintptr_t) p_value * 0x9E3779B97F4A7C15ULL ) >> 32 );
+}
+
+static size_t mru_stack_find ( const mru_stack *const p_mru_stack, const void *const p_value, size_t hash, size_t *const p_slot )
+{
+
+	// Initialized data
+	size_t slot = hash & p_mru_stack->mask;
+
+	// Probe until the value or an empty slot is found
+	for (size_t node = p_mru_stack->_p_slots[slot]; node != SIZE_MAX; node = p_mru_stack->_p_slots[slot])
+	{
+
+		// Initialized data
+		const struct mru_node_s *p_node = &p_mru_stack->_p_nodes[node];
+
+		// Compare the hash first, so the equality function is rarely called
+		if ( p_node->hash == hash )
+			if ( p_mru_stack->pfn_equal ? p_mru_stack->pfn_equal(p_node->p_value, p_value) : ( p_node->p_value == p_value ) )
+			{
+
+				// Return the slot to the caller
+				*p_slot = slot;
+
+				// Success
+				return node;
+			}
+
+		// Next slot
+		slot = ( slot + 1 ) & p_mru_stack->mask;
+	}
+
+	// Return the empty slot to the caller
+	*p_slot = slot;
+
+	// Not found
+	return SIZE_MAX;
+}
+
+static void mru_stack_unlink ( mru_stack *const p_mru_stack, size_t node )
+{
+
+	// Initialized data
+	struct mru_node_s *p_node = &p_mru_stack->_p_nodes[node];
+
+	// Detach from the node above
+	if ( p_node->above != SIZE_MAX ) p_mru_stack->_p_nodes[p_node->above].below = p_node->below;
+	else                             p_mru_stack->top                           = p_node->below;
+
+	// Detach from the node below
+	if ( p_node->below != SIZE_MAX ) p_mru_stack->_p_nodes[p_node->below].above = p_node->above;
+	else                             p_mru_stack->bottom                        = p_node->above;
+}
+
+static void mru_stack_link ( mru_stack *const p_mru_stack, size_t node )
+{
+
+	// Initialized data
+	struct mru_node_s *p_node = &p_mru_stack->_p_nodes[node];
+
+	// Place the node above the top
+	p_node->above = SIZE_MAX;
+	p_node->below = p_mru_stack->top;
+
+	// Attach to the old top
+	if ( p_mru_stack->top != SIZE_MAX ) p_mru_stack->_p_nodes[p_mru_stack->top].above = node;
+	else                                p_mru_stack->bottom                           = node;
+
+	// The node is the new top
+	p_mru_stack->top = node;
+}
+
+static const void *mru_stack_take ( mru_stack *const p_mru_stack, size_t node )
+{
+
+	// Initialized data
+	struct mru_node_s *p_node = &p_mru_stack->_p_nodes[node];
+	size_t             mask   = p_mru_stack->mask,
+	                   hole   = p_node->hash & mask;
+
+	// Find the slot that indexes the node
+	while ( p_mru_stack->_p_slots[hole] != node ) hole = ( hole + 1 ) & mask;
+
+	// Shift the rest of the probe sequence back, instead of leaving a tombstone
+	for (size_t i = ( hole + 1 ) & mask; p_mru_stack->_p_slots[i] != SIZE_MAX; i = ( i + 1 ) & mask)
+	{
+
+		// Initialized data
+		size_t home = p_mru_stack->_p_nodes[p_mru_stack->_p_slots[i]].hash & mask;
+
+		// The entry can fill the hole if the hole is between its home slot and its slot
+		if ( ( ( i - home ) & mask ) >= ( ( i - hole ) & mask ) )
+		{
+			p_mru_stack->_p_slots[hole] = p_mru_stack->_p_slots[i];
+			hole                        = i;
+		}
+	}
+
+	// Empty the last slot
+	p_mru_stack->_p_slots[hole] = SIZE_MAX;
+
+	// Unlink the node
+	mru_stack_unlink(p_mru_stack, node);
+	p_mru_stack->count--;
+
+	// Return the node to the free list
+	p_node->below     = p_mru_stack->free;
+	p_mru_stack->free = node;
+
+	// Success
+	return p_node->p_value;
+}
+
+int intrusive_stack_construct ( intrusive_stack **const pp_intrusive_stack )
+{
+
+	// Initialize the library
+	stack_init();
+
+	// Argument check
+	if ( pp_intrusive_stack == (void *) 0 ) goto no_intrusive_stack;
+
+	// Initialized data
+	intrusive_stack *p_intrusive_stack = STACK_REALLOC(0, sizeof(intrusive_stack));
+
+	// Error check
+	if ( p_intrusive_stack == (void *) 0 ) goto no_mem;
+
+	// Zero set
+	memset(p_intrusive_stack, 0, sizeof(intrusive_stack));
+
+	// Create a mutex
+	if ( mutex_create(&p_intrusive_stack->_lock) == 0 ) goto failed_to_mutex_create;
+
+	// Return a pointer to the caller
+	*pp_intrusive_stack = p_intrusive_stack;
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_intrusive_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_intrusive_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// sync errors
+		{
+			failed_to_mutex_create:
+				#ifndef NDEBUG
+					log_error("[stack] Failed to create mutex in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Free the intrusive stack
+				p_intrusive_stack = STACK_REALLOC(p_intrusive_stack, 0);
+
+				// Error
+				return 0;
+		}
+
+		// Standard library errors
+		{
+			no_mem:
+				#ifndef NDEBUG
+					log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int intrusive_stack_push ( intrusive_stack *const p_intrusive_stack, stack_node *const p_node )
+{
+
+	// Argument check
+	if ( p_intrusive_stack == (void *) 0 ) goto no_intrusive_stack;
+	if ( p_node            == (void *) 0 ) goto no_node;
+
+	// Lock
+	mutex_lock(&p_intrusive_stack->_lock);
+
+	// The first node is also the bottom
+	if ( p_intrusive_stack->p_top == (void *) 0 ) p_intrusive_stack->p_bottom = p_node;
+
+	// Push the node onto the stack
+	p_node->p_next           = p_intrusive_stack->p_top;
+	p_intrusive_stack->p_top = p_node;
+
+	// Unlock
+	mutex_unlock(&p_intrusive_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_intrusive_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_intrusive_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_node:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_node\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int intrusive_stack_pop ( intrusive_stack *const p_intrusive_stack, stack_node **const ret )
+{
+
+	// Argument check
+	if ( p_intrusive_stack == (void *) 0 ) goto no_intrusive_stack;
+
+	// Initialized data
+	stack_node *p_node = 0;
+
+	// Lock
+	mutex_lock(&p_intrusive_stack->_lock);
+
+	// Error checking
+	if ( p_intrusive_stack->p_top == (void *) 0 ) goto stack_underflow;
+
+	// Pop the stack
+	p_node                   = p_intrusive_stack->p_top;
+	p_intrusive_stack->p_top = p_node->p_next;
+
+	// The last node was also the bottom
+	if ( p_intrusive_stack->p_top == (void *) 0 ) p_intrusive_stack->p_bottom = 0;
+
+	// Unlock
+	mutex_unlock(&p_intrusive_stack->_lock);
+
+	// Return the node to the caller
+	if ( ret ) *ret = p_node;
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// stack errors
+		{
+			stack_underflow:
+
+				// Unlock
+				mutex_unlock(&p_intrusive_stack->_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Stack Underflow!\n");
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// Argument errors
+		{
+			no_intrusive_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_intrusive_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int intrusive_stack_pop_all ( intrusive_stack *const p_intrusive_stack, stack_node **const ret )
+{
+
+	// Argument check
+	if ( p_intrusive_stack == (void *) 0 ) goto no_intrusive_stack;
+	if ( ret               == (void *) 0 ) goto no_ret;
+
+	// Lock
+	mutex_lock(&p_intrusive_stack->_lock);
+
+	// Detach every node
+	*ret                        = p_intrusive_stack->p_top;
+	p_intrusive_stack->p_top    = 0;
+	p_intrusive_stack->p_bottom = 0;
+
+	// Unlock
+	mutex_unlock(&p_intrusive_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_intrusive_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_intrusive_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_ret:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"ret\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int intrusive_stack_splice ( intrusive_stack *const p_destination, intrusive_stack *const p_source )
+{
+
+	// Argument check
+	if ( p_destination == (void *) 0 ) goto no_destination;
+	if ( p_source      == (void *) 0 ) goto no_source;
+	if ( p_destination == p_source   ) goto same_stack;
+
+	// Initialized data
+	intrusive_stack *p_first  = ( p_destination < p_source ) ? p_destination : p_source,
+	                *p_second = ( p_destination < p_source ) ? p_source : p_destination;
+
+	// Lock both stacks, in address order
+	mutex_lock(&p_first->_lock);
+	mutex_lock(&p_second->_lock);
+
+	// Link the bottom of the source to the top of the destination
+	if ( p_source->p_top )
+	{
+
+		// The source's bottom rests on the destination's top
+		p_source->p_bottom->p_next = p_destination->p_top;
+
+		// An empty destination takes the source's bottom
+		if ( p_destination->p_top == (void *) 0 ) p_destination->p_bottom = p_source->p_bottom;
+
+		// The source's top is the new top
+		p_destination->p_top = p_source->p_top;
+
+		// Empty the source
+		p_source->p_top    = 0;
+		p_source->p_bottom = 0;
+	}
+
+	// Unlock
+	mutex_unlock(&p_second->_lock);
+	mutex_unlock(&p_first->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_destination:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_destination\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_source:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_source\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			same_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Parameters \"p_destination\" and \"p_source\" are the same stack in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int intrusive_stack_peek ( intrusive_stack *const p_intrusive_stack, stack_node **const ret )
+{
+
+	// Argument check
+	if ( p_intrusive_stack == (void *) 0 ) goto no_intrusive_stack;
+	if ( ret               == (void *) 0 ) goto no_ret;
+
+	// Lock
+	mutex_lock(&p_intrusive_stack->_lock);
+
+	// Error checking
+	if ( p_intrusive_stack->p_top == (void *) 0 ) goto stack_underflow;
+
+	// Return the node to the caller
+	*ret = p_intrusive_stack->p_top;
+
+	// Unlock
+	mutex_unlock(&p_intrusive_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// stack errors
+		{
+			stack_underflow:
+
+				// Unlock
+				mutex_unlock(&p_intrusive_stack->_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Stack Underflow!\n");
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// Argument errors
+		{
+			no_intrusive_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_intrusive_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_ret:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"ret\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int intrusive_stack_destroy ( intrusive_stack **const pp_intrusive_stack )
+{
+
+	// Argument check
+	if ( pp_intrusive_stack == (void *) 0 ) goto no_intrusive_stack;
+
+	// Initialized data
+	intrusive_stack *p_intrusive_stack = *pp_intrusive_stack;
+
+	// Error checking
+	if ( p_intrusive_stack == (void *) 0 ) goto pointer_to_null_pointer;
+
+	// No more pointer for caller
+	*pp_intrusive_stack = 0;
+
+	// Destroy the mutex
+	mutex_destroy(&p_intrusive_stack->_lock);
+
+	// Free the intrusive stack. The nodes belong to the caller
+	p_intrusive_stack = STACK_REALLOC(p_intrusive_stack, 0);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_intrusive_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_intrusive_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			pointer_to_null_pointer:
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"pp_intrusive_stack\" points to null pointer in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int lockfree_stack_construct ( lockfree_stack **const pp_lockfree_stack )
+{
+
+	// Initialize the library
+	stack_init();
+
+	// Argument check
+	if ( pp_lockfree_stack == (void *) 0 ) goto no_lockfree_stack;
+
+	// Initialized data
+	lockfree_stack *p_lockfree_stack = STACK_REALLOC(0, sizeof(lockfree_stack));
+
+	// Error check
+	if ( p_lockfree_stack == (void *) 0 ) goto no_mem;
+
+	// Empty the stack
+	atomic_init(&p_lockfree_stack->top, STACK_TAG_PACK(0, 0));
+
+	// Return a pointer to the caller
+	*pp_lockfree_stack = p_lockfree_stack;
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_lockfree_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_lockfree_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// Standard library errors
+		{
+			no_mem:
+				#ifndef NDEBUG
+					log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int lockfree_stack_push ( lockfree_stack *const p_lockfree_stack, stack_node *const p_node )
+{
+
+	// Argument check
+	if ( p_lockfree_stack == (void *) 0 ) goto no_lockfree_stack;
+	if ( p_node           == (void *) 0 ) goto no_node;
+
+	// Initialized data
+	uint64_t top = atomic_load_explicit(&p_lockfree_stack->top, memory_order_relaxed);
+
+	// Link the node above the top, until no other thread moved the top in between
+	do
+		STACK_NEXT_STORE(p_node, STACK_TAG_POINTER(top));
+	while ( atomic_compare_exchange_weak_explicit(&p_lockfree_stack->top, &top, STACK_TAG_PACK(p_node, STACK_TAG_NEXT(top)), memory_order_release, memory_order_relaxed) == false );
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_lockfree_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_lockfree_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_node:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_node\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int lockfree_stack_pop ( lockfree_stack *const p_lockfree_stack, stack_node **const ret )
+{
+
+	// Argument check
+	if ( p_lockfree_stack == (void *) 0 ) goto no_lockfree_stack;
+
+	// Initialized data
+	uint64_t    top    = atomic_load_explicit(&p_lockfree_stack->top, memory_order_acquire);
+	stack_node *p_node = 0;
+
+	// Unlink the top node, until no other thread moved the top in between. If
+	// the node was popped and pushed back meanwhile, the tag has changed, so a
+	// stale next pointer is never installed
+	do
+	{
+
+		// Initialized data
+		p_node = STACK_TAG_POINTER(top);
+
+		// Error checking
+		if ( p_node == (void *) 0 ) goto stack_underflow;
+
+	} while ( atomic_compare_exchange_weak_explicit(&p_lockfree_stack->top, &top, STACK_TAG_PACK(STACK_NEXT_LOAD(p_node), STACK_TAG_NEXT(top)), memory_order_acquire, memory_order_acquire) == false );
+
+	// Return the node to the caller
+	if ( ret ) *ret = p_node;
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// stack errors
+		{
+			stack_underflow:
+				#ifndef NDEBUG
+					log_error("[stack] Stack Underflow!\n");
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// Argument errors
+		{
+			no_lockfree_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_lockfree_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int lockfree_stack_pop_all ( lockfree_stack *const p_lockfree_stack, stack_node **const ret )
+{
+
+	// Argument check
+	if ( p_lockfree_stack == (void *) 0 ) goto no_lockfree_stack;
+	if ( ret              == (void *) 0 ) goto no_ret;
+
+	// Initialized data
+	uint64_t top = atomic_load_explicit(&p_lockfree_stack->top, memory_order_relaxed);
+
+	// Detach every node. The tag still advances, so concurrent pops can't
+	// mistake a refilled stack for the one they read
+	while ( atomic_compare_exchange_weak_explicit(&p_lockfree_stack->top, &top, STACK_TAG_PACK(0, STACK_TAG_NEXT(top)), memory_order_acquire, memory_order_relaxed) == false );
+
+	// Return the nodes to the caller
+	*ret = STACK_TAG_POINTER(top);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_lockfree_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_lockfree_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_ret:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"ret\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int lockfree_stack_destroy ( lockfree_stack **const pp_lockfree_stack )
+{
+
+	// Argument check
+	if ( pp_lockfree_stack == (void *) 0 ) goto no_lockfree_stack;
+
+	// Initialized data
+	lockfree_stack *p_lockfree_stack = *pp_lockfree_stack;
+
+	// Error checking
+	if ( p_lockfree_stack == (void *) 0 ) goto pointer_to_null_pointer;
+
+	// No more pointer for caller
+	*pp_lockfree_stack = 0;
+
+	// Free the lock free stack. The nodes belong to the caller
+	p_lockfree_stack = STACK_REALLOC(p_lockfree_stack, 0);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_lockfree_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_lockfree_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			pointer_to_null_pointer:
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"pp_lockfree_stack\" points to null pointer in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+#ifdef __linux__
+int shared_stack_region_size ( size_t size, size_t *const p_region_size )
+{
+
+	// Argument check
+	if ( size < 1 ) goto no_size;
+	if ( p_region_size == (void *) 0 ) goto no_region_size;
+	if ( size > ( SIZE_MAX - sizeof(shared_stack) ) / sizeof(ptrdiff_t) ) goto too_large;
+
+	// Return the quantity of bytes to the caller
+	*p_region_size = sizeof(shared_stack) + ( size * sizeof(ptrdiff_t) );
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_size:
+				#ifndef NDEBUG
+					log_error("[stack] No size provided in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_region_size:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_region_size\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			too_large:
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"size\" is too large in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int shared_stack_construct ( shared_stack **const pp_shared_stack, void *const p_region, size_t region_size )
+{
+
+	// Initialize the library
+	stack_init();
+
+	// Argument check
+	if ( pp_shared_stack == (void *) 0 ) goto no_shared_stack;
+	if ( p_region        == (void *) 0 ) goto no_region;
+	if ( region_size < sizeof(shared_stack) + sizeof(ptrdiff_t) ) goto region_too_small;
+	if ( (uintptr_t) p_region % _Alignof(shared_stack) ) goto region_misaligned;
+
+	// Initialized data
+	shared_stack        *p_shared_stack = p_region;
+	size_t               size           = ( region_size - sizeof(shared_stack) ) / sizeof(ptrdiff_t),
+	                     needed         = 0;
+	pthread_mutexattr_t  attributes;
+
+	// Error checking. The capacity must fit in the region
+	if ( shared_stack_region_size(size, &needed) == 0 || needed > region_size ) goto region_too_small;
+
+	// Zero set
+	memset(p_shared_stack, 0, sizeof(shared_stack));
+
+	// Set the size
+	p_shared_stack->size = size;
+
+	// Create a process shared, robust mutex
+	if ( pthread_mutexattr_init(&attributes) ) goto failed_to_mutex_create;
+	if ( pthread_mutexattr_setpshared(&attributes, PTHREAD_PROCESS_SHARED) ) goto failed_to_set_attributes;
+	if ( pthread_mutexattr_setrobust(&attributes, PTHREAD_MUTEX_ROBUST) ) goto failed_to_set_attributes;
+	if ( pthread_mutex_init(&p_shared_stack->_lock, &attributes) ) goto failed_to_set_attributes;
+	pthread_mutexattr_destroy(&attributes);
+
+	// Publish the shared stack to other processes
+	__atomic_store_n(&p_shared_stack->magic, SHARED_STACK_MAGIC, __ATOMIC_RELEASE);
+
+	// Return a pointer to the caller
+	*pp_shared_stack = p_shared_stack;
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_shared_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_shared_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_region:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_region\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			region_too_small:
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"region_size\" is too small in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			region_misaligned:
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"p_region\" is misaligned in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// pthread errors
+		{
+			failed_to_set_attributes:
+
+				// Destroy the attributes
+				pthread_mutexattr_destroy(&attributes);
+
+				// Fall through
+
+			failed_to_mutex_create:
+				#ifndef NDEBUG
+					log_error("[stack] Failed to create mutex in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int shared_stack_attach ( shared_stack **const pp_shared_stack, void *const p_region )
+{
+
+	// Initialize the library
+	stack_init();
+
+	// Argument check
+	if ( pp_shared_stack == (void *) 0 ) goto no_shared_stack;
+	if ( p_region        == (void *) 0 ) goto no_region;
+
+	// Initialized data
+	shared_stack *p_shared_stack = p_region;
+
+	// Error checking
+	if ( __atomic_load_n(&p_shared_stack->magic, __ATOMIC_ACQUIRE) != SHARED_STACK_MAGIC ) goto not_a_shared_stack;
+
+	// Return a pointer to the caller
+	*pp_shared_stack = p_shared_stack;
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_shared_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_shared_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_region:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_region\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// stack errors
+		{
+			not_a_shared_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"p_region\" does not contain a shared stack in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int shared_stack_push ( shared_stack *const p_shared_stack, const void *const p_value )
+{
+
+	// Argument check
+	if ( p_shared_stack == (void *) 0 ) goto no_shared_stack;
+	if ( p_value        == (void *) 0 ) goto no_value;
+
+	// Lock
+	if ( shared_stack_lock(p_shared_stack) == 0 ) goto failed_to_lock;
+
+	// Error checking
+	if ( p_shared_stack->offset == p_shared_stack->size ) goto stack_overflow;
+
+	// Write the element
+	p_shared_stack->_p_data[p_shared_stack->offset] = (const char *) p_value - (const char *) p_shared_stack;
+
+	// Keep the compiler from publishing the element before it is written
+	atomic_signal_fence(memory_order_release);
+
+	// Publish it
+	p_shared_stack->offset++;
+
+	// Unlock
+	pthread_mutex_unlock(&p_shared_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_shared_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_shared_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_value:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// stack errors
+		{
+			failed_to_lock:
+				#ifndef NDEBUG
+					log_error("[stack] Failed to lock shared stack in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			stack_overflow:
+
+				// Unlock
+				pthread_mutex_unlock(&p_shared_stack->_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Stack overflow!\n");
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int shared_stack_pop ( shared_stack *const p_shared_stack, void **const ret )
+{
+
+	// Argument check
+	if ( p_shared_stack == (void *) 0 ) goto no_shared_stack;
+
+	// Lock
+	if ( shared_stack_lock(p_shared_stack) == 0 ) goto failed_to_lock;
+
+	// Error checking
+	if ( p_shared_stack->offset < 1 ) goto stack_underflow;
+
+	// Return the value to the caller, relative to this process's mapping
+	if ( ret ) *ret = (char *) p_shared_stack + p_shared_stack->_p_data[p_shared_stack->offset - 1];
+
+	// Keep the compiler from dropping the element before it is returned
+	atomic_signal_fence(memory_order_release);
+
+	// Pop the stack
+	p_shared_stack->offset--;
+
+	// Unlock
+	pthread_mutex_unlock(&p_shared_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_shared_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_shared_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// stack errors
+		{
+			failed_to_lock:
+				#ifndef NDEBUG
+					log_error("[stack] Failed to lock shared stack in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			stack_underflow:
+
+				// Unlock
+				pthread_mutex_unlock(&p_shared_stack->_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Stack Underflow!\n");
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int shared_stack_peek ( shared_stack *const p_shared_stack, void **const ret )
+{
+
+	// Argument check
+	if ( p_shared_stack == (void *) 0 ) goto no_shared_stack;
+	if ( ret            == (void *) 0 ) goto no_ret;
+
+	// Lock
+	if ( shared_stack_lock(p_shared_stack) == 0 ) goto failed_to_lock;
+
+	// Error checking
+	if ( p_shared_stack->offset < 1 ) goto stack_underflow;
+
+	// Return the value to the caller, relative to this process's mapping
+	*ret = (char *) p_shared_stack + p_shared_stack->_p_data[p_shared_stack->offset - 1];
+
+	// Unlock
+	pthread_mutex_unlock(&p_shared_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_shared_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"p_shared_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			no_ret:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"ret\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+
+		// stack errors
+		{
+			failed_to_lock:
+				#ifndef NDEBUG
+					log_error("[stack] Failed to lock shared stack in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			stack_underflow:
+
+				// Unlock
+				pthread_mutex_unlock(&p_shared_stack->_lock);
+
+				#ifndef NDEBUG
+					log_error("[stack] Stack Underflow!\n");
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+int shared_stack_destroy ( shared_stack **const pp_shared_stack )
+{
+
+	// Argument check
+	if ( pp_shared_stack == (void *) 0 ) goto no_shared_stack;
+
+	// Initialized data
+	shared_stack *p_shared_stack = *pp_shared_stack;
+
+	// Error checking
+	if ( p_shared_stack == (void *) 0 ) goto pointer_to_null_pointer;
+
+	// No more pointer for caller
+	*pp_shared_stack = 0;
+
+	// Other processes can no longer attach
+	__atomic_store_n(&p_shared_stack->magic, 0, __ATOMIC_RELEASE);
+
+	// Destroy the mutex
+	pthread_mutex_destroy(&p_shared_stack->_lock);
+
+	// Success
+	return 1;
+
+	// Error handling
+	{
+
+		// Argument errors
+		{
+			no_shared_stack:
+				#ifndef NDEBUG
+					log_error("[stack] Null pointer provided for \"pp_shared_stack\" in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+
+			pointer_to_null_pointer:
+				#ifndef NDEBUG
+					log_error("[stack] Parameter \"pp_shared_stack\" points to null pointer in call to function \"%s\"\n", __FUNCTION__);
+				#endif
+
+				// Error
+				return 0;
+		}
+	}
+}
+
+static int shared_stack_lock ( shared_stack *const p_shared_stack )
+{
+
+	// Initialized data
+	int result = pthread_mutex_lock(&p_shared_stack->_lock);
+
+	// The previous owner died while holding the lock. Every stack operation 
+	// leaves the stack consistent, so the lock is recovered as is
+	if ( result == EOWNERDEAD ) result = pthread_mutex_consistent(&p_shared_stack->_lock);
+
+	// Success
+	return ( result == 0 );
+}
+#endif
+
 void stack_exit ( void )
 {
     
     // State check
-    if ( initialized == false ) return;
+    if ( atomic_load_explicit(&initialized, memory_order_acquire) != 2 ) return;
 
     // Clean up the log library
-    log_exit();
+    #ifndef STACK_NO_LOG
+        log_exit();
+    #endif
 
     // Clean up the sync library
     sync_exit();
 
     // Clear the initialized flag
-    initialized = false;
+    atomic_store_explicit(&initialized, 0, memory_order_release);
 
     // Done
     return;
@@ -6,16 +6,31 @@
  * @author Jacob Smith
 */
 
+// Feature test macros
+#ifdef __linux__
+    #ifndef _GNU_SOURCE
+        #define _GNU_SOURCE
+    #endif
+#endif
+
 // Include
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 #include <log/log.h>
 
 #include <stack/stack.h>
 
+#ifdef __linux__
+    #include <unistd.h>
+    #include <sys/eventfd.h>
+    #include <sys/mman.h>
+    #include <sys/wait.h>
+#endif
+
 // Possible values
 void *A_value = (void *) 0x0000000000000001,
      *B_value = (void *) 0x0000000000000002,
@@ -67,6 +82,30 @@ int test_one_element_stack   ( int (*stack_constructor)(stack **), char *name, c
 int test_two_element_stack   ( int (*stack_constructor)(stack **), char *name, char **keys );
 int test_three_element_stack ( int (*stack_constructor)(stack **), char *name, char **keys );
 
+int test_notify    ( char *name );
+int test_aggregate ( char *name );
+int test_records   ( char *name );
+int test_arena     ( char *name );
+int test_search    ( char *name );
+int test_pool      ( char *name );
+int test_splice    ( char *name );
+int test_drain     ( char *name );
+int test_watermark ( char *name );
+int test_shared    ( char *name );
+int test_frames    ( char *name );
+int test_priority  ( char *name );
+int test_ring      ( char *name );
+int test_mru       ( char *name );
+int test_intrusive ( char *name );
+
+void count_watermark ( stack *const p_stack, bool high );
+size_t string_hash ( const void *const p_value );
+bool string_equal ( const void *const p_a, const void *const p_b );
+
+void record_for_each ( const void *const p_value, size_t i );
+
+const void *combine_max ( const void *const p_a, const void *const p_b );
+
 int construct_empty         ( stack **pp_stack );
 int construct_empty_pushA_A ( stack **pp_stack );
 int construct_A_pop_empty   ( stack **pp_stack );
@@ -87,6 +126,9 @@ int main ( int argc, const char* argv[] )
     (void) argc;
     (void) argv;
 
+    // Initialize the stack library
+    stack_init();
+
     // Formatting
     printf(
         "╭──────────────╮\n"\
@@ -199,6 +241,51 @@ int run_tests ( void )
     // [ A, B, C ] -> pop() -> [ A, B, _ ]
     test_two_element_stack(construct_ABC_pop_AB, "ABC_pop_AB", (char **)AB_keys);
 
+    // Readiness notifications
+    test_notify("notify");
+
+    // Running aggregate
+    test_aggregate("aggregate_max");
+
+    // Variable length records
+    test_records("records");
+
+    // Scratch arena
+    test_arena("arena");
+
+    // Iteration and search
+    test_search("search");
+
+    // Stack pool
+    test_pool("pool");
+
+    // Splice, steal and clone
+    test_splice("splice");
+
+    // Pop everything at once
+    test_drain("drain");
+
+    // Watermarks
+    test_watermark("watermark");
+
+    // Process shared stack
+    test_shared("shared");
+
+    // Scoped frames
+    test_frames("frames");
+
+    // Priority levels
+    test_priority("priority");
+
+    // Bounded history
+    test_ring("ring");
+
+    // Most recently used
+    test_mru("mru");
+
+    // Intrusive links
+    test_intrusive("intrusive");
+
     // Success
     return 1;
 }
@@ -366,6 +453,843 @@ int test_three_element_stack ( int (*stack_constructor)(stack **), char *name, c
     return 1;
 }
 
+int test_notify ( char *name )
+{
+
+    // Print the name of the scenario
+    log_scenario("%s\n", name);
+
+    #ifdef __linux__
+
+        // Initialized data
+        stack         *p_stack = 0;
+        int            fd      = -1;
+        eventfd_t      value   = 0;
+
+        // Construct a stack, and signal when it falls below 2 elements
+        stack_construct(&p_stack, 3);
+        print_test(name, "stack_notify_enable", stack_notify_enable(p_stack, 2, &fd) == 1 );
+
+        // Empty stack
+        print_test(name, "empty_not_ready", eventfd_read(fd, &value) == -1 );
+
+        // [ _, _, _ ] -> push(A) -> [ A, _, _ ]
+        stack_push(p_stack, A_key);
+        print_test(name, "push_A_ready", eventfd_read(fd, &value) == 0 );
+
+        // [ A, _, _ ] -> push(B) -> [ A, B, _ ]
+        stack_push(p_stack, B_key);
+        print_test(name, "push_B_not_ready", eventfd_read(fd, &value) == -1 );
+
+        // [ A, B, _ ] -> pop() -> [ A, _, _ ]
+        stack_pop(p_stack, 0);
+        print_test(name, "pop_below_threshold_ready", eventfd_read(fd, &value) == 0 );
+
+        print_test(name, "stack_notify_disable", stack_notify_disable(p_stack) == 1 );
+
+        // Free the stack
+        stack_destroy(&p_stack);
+    #endif
+
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+const void *combine_max ( const void *const p_a, const void *const p_b )
+{
+
+    // Success
+    return ( (size_t) p_a > (size_t) p_b ) ? p_a : p_b;
+}
+
+int test_aggregate ( char *name )
+{
+
+    // Initialized data
+    stack      *p_stack = 0;
+    const void *result  = 0;
+
+    // Print the name of the scenario
+    log_scenario("%s\n", name);
+
+    // Construct an augmented stack
+    stack_construct_augmented(&p_stack, 3, combine_max);
+
+    print_test(name, "empty_aggregate", stack_aggregate(p_stack, &result) == 0 );
+
+    // [ _, _, _ ] -> push(2) -> push(3) -> push(1) -> [ 2, 3, 1 ]
+    stack_push(p_stack, B_value);
+    stack_push(p_stack, C_value);
+    stack_push(p_stack, A_value);
+    print_test(name, "max_BCA", stack_aggregate(p_stack, &result) == 1 && result == C_value );
+
+    // [ 2, 3, 1 ] -> pop() -> pop() -> [ 2, _, _ ]
+    stack_pop(p_stack, 0);
+    stack_pop(p_stack, 0);
+    print_test(name, "max_B", stack_aggregate(p_stack, &result) == 1 && result == B_value );
+
+    // Free the stack
+    stack_destroy(&p_stack);
+
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+int test_records ( char *name )
+{
+
+    // Initialized data
+    record_stack *p_record_stack = 0;
+    void         *p_reservation  = 0;
+    const void   *p_record       = 0;
+    size_t        size           = 0;
+
+    // Print the name of the scenario
+    log_scenario("%s\n", name);
+
+    // Construct a record stack
+    print_test(name, "construct_too_large", record_stack_construct(&p_record_stack, SIZE_MAX - 8) == 0 );
+    record_stack_construct(&p_record_stack, 128);
+
+    print_test(name, "empty_pop", record_stack_pop(p_record_stack, &p_record, &size) == 0 );
+
+    // push("hello")
+    print_test(name, "push_hello", record_stack_push(p_record_stack, "hello", 6) == 1 );
+
+    // reserve, write "hi", commit
+    record_stack_reserve(p_record_stack, 16, &p_reservation);
+    strcpy(p_reservation, "hi");
+    print_test(name, "commit_hi", record_stack_commit(p_record_stack, 3) == 1 );
+
+    // Too large
+    print_test(name, "reserve_overflow", record_stack_reserve(p_record_stack, 256, &p_reservation) == 0 );
+    print_test(name, "reserve_wrap", record_stack_reserve(p_record_stack, SIZE_MAX - 8, &p_reservation) == 0 );
+
+    // No reservation
+    print_test(name, "commit_unreserved", record_stack_commit(p_record_stack, 0) == 0 );
+    print_test(name, "cancel_unreserved", record_stack_cancel(p_record_stack) == 0 );
+
+    // Committing more than the reservation drops it
+    record_stack_reserve(p_record_stack, 4, &p_reservation);
+    print_test(name, "reserve_twice", record_stack_reserve(p_record_stack, 4, &p_reservation) == 0 );
+    print_test(name, "commit_too_large", record_stack_commit(p_record_stack, 8) == 0 );
+    print_test(name, "cancel_dropped", record_stack_cancel(p_record_stack) == 0 );
+
+    // pop() -> "hi"
+    print_test(name, "pop_hi", record_stack_pop(p_record_stack, &p_record, &size) == 1 && size == 3 && strcmp(p_record, "hi") == 0 );
+
+    // pop() -> "hello"
+    print_test(name, "pop_hello", record_stack_pop(p_record_stack, &p_record, &size) == 1 && size == 6 && strcmp(p_record, "hello") == 0 );
+
+    print_test(name, "pop_pop_pop", record_stack_pop(p_record_stack, &p_record, &size) == 0 );
+
+    // Free the record stack
+    record_stack_destroy(&p_record_stack);
+
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+int test_arena ( char *name )
+{
+
+    // Initialized data
+    stack_arena *p_stack_arena = 0;
+    void        *p_a           = 0,
+                *p_b           = 0,
+                *p_c           = 0;
+    size_t       mark          = 0;
+
+    // Print the name of the scenario
+    log_scenario("%s\n", name);
+
+    // Construct a scratch arena
+    print_test(name, "construct_too_large", stack_arena_construct(&p_stack_arena, SIZE_MAX - 8) == 0 );
+    stack_arena_construct(&p_stack_arena, 256);
+
+    print_test(name, "alloc_A", stack_arena_alloc(p_stack_arena, 3, 0, &p_a) == 1 );
+    print_test(name, "mark", stack_arena_mark(p_stack_arena, &mark) == 1 );
+    print_test(name, "alloc_B_aligned", stack_arena_alloc(p_stack_arena, 8, 64, &p_b) == 1 && ( (size_t) p_b % 64 ) == 0 );
+    print_test(name, "alloc_overflow", stack_arena_alloc(p_stack_arena, 512, 0, &p_c) == 0 );
+    print_test(name, "release", stack_arena_release(p_stack_arena, mark) == 1 );
+    print_test(name, "alloc_C_reuses_B", stack_arena_alloc(p_stack_arena, 8, 64, &p_c) == 1 && p_c == p_b );
+    print_test(name, "release_bad_mark", stack_arena_release(p_stack_arena, 1024) == 0 );
+
+    // Free the scratch arena
+    stack_arena_destroy(&p_stack_arena);
+
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+const void *for_each_values[4]  = { 0 };
+size_t      for_each_indices[4] = { 0 },
+            for_each_count      = 0;
+
+void record_for_each ( const void *const p_value, size_t i )
+{
+
+    // Record the value and its index, in the order they are visited
+    if ( for_each_count < 4 )
+    {
+        for_each_values[for_each_count]  = p_value;
+        for_each_indices[for_each_count] = i;
+    }
+
+    // Count the visit
+    for_each_count++;
+
+    // Done
+    return;
+}
+
+int test_search ( char *name )
+{
+
+    // Initialized data
+    stack      *p_stack = 0;
+    const void *result  = 0;
+    size_t      index   = 0;
+
+    // Print the name of the scenario
+    log_scenario("%s\n", name);
+
+    // Construct a stack
+    stack_construct(&p_stack, 64);
+
+    // [ 1, 2, ..., 37 ]
+    for (size_t i = 1; i <= 37; i++) stack_push(p_stack, (void *) i);
+
+    print_test(name, "get_top"     , stack_get(p_stack, 0, &result) == 1 && result == (void *) 37 );
+    print_test(name, "get_bottom"  , stack_get(p_stack, 36, &result) == 1 && result == (void *) 1 );
+    print_test(name, "get_oob"     , stack_get(p_stack, 37, &result) == 0 );
+    print_test(name, "find_top"    , stack_find(p_stack, (void *) 37, &index) == 1 && index == 0 );
+    print_test(name, "find_bottom" , stack_find(p_stack, (void *) 1, &index) == 1 && index == 36 );
+    print_test(name, "find_middle" , stack_find(p_stack, (void *) 20, &index) == 1 && index == 17 );
+    print_test(name, "contains_X"  , stack_contains(p_stack, X_value) == 0 );
+
+    // Find returns the topmost occurrence
+    stack_push(p_stack, (void *) 1);
+    stack_push(p_stack, (void *) 38);
+    print_test(name, "find_topmost", stack_find(p_stack, (void *) 1, &index) == 1 && index == 1 );
+
+    // [ 1, 2, 3 ]
+    while ( stack_pop(p_stack, 0) );
+    stack_push(p_stack, A_value);
+    stack_push(p_stack, B_value);
+    stack_push(p_stack, C_value);
+
+    // Top to bottom
+    for_each_count = 0;
+    stack_for_each(p_stack, record_for_each);
+    print_test(name, "for_each",
+        for_each_count == 3 &&
+        for_each_values[0] == C_value && for_each_indices[0] == 0 &&
+        for_each_values[1] == B_value && for_each_indices[1] == 1 &&
+        for_each_values[2] == A_value && for_each_indices[2] == 2
+    );
+
+    // Bottom to top
+    for_each_count = 0;
+    stack_for_each_reverse(p_stack, record_for_each);
+    print_test(name, "for_each_reverse",
+        for_each_count == 3 &&
+        for_each_values[0] == A_value && for_each_indices[0] == 2 &&
+        for_each_values[1] == B_value && for_each_indices[1] == 1 &&
+        for_each_values[2] == C_value && for_each_indices[2] == 0
+    );
+
+    // Free the stack
+    stack_destroy(&p_stack);
+
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+int test_pool ( char *name )
+{
+
+    // Initialized data
+    stack_pool *p_stack_pool = 0;
+    pool_stack *p_stacks[5]  = { 0 },
+               *p_reused     = 0;
+    const void *result       = 0;
+    bool        acquired     = true;
+
+    // Print the name of the scenario
+    log_scenario("%s\n", name);
+
+    // Slabs too large to allocate
+    print_test(name, "construct_huge_stacks", stack_pool_construct(&p_stack_pool, SIZE_MAX / 4, 2, 1) == 0 );
+    print_test(name, "construct_huge_slabs", stack_pool_construct(&p_stack_pool, 2, SIZE_MAX / 8, 1) == 0 );
+    print_test(name, "construct_huge_stripes", stack_pool_construct(&p_stack_pool, 2, 2, SIZE_MAX / 8) == 0 );
+
+    // Construct a pool of 2 element stacks, 2 stacks per slab
+    stack_pool_construct(&p_stack_pool, 2, 2, 3);
+
+    // Acquire enough stacks to span three slabs
+    for (size_t i = 0; i < 5; i++) acquired &= stack_pool_acquire(p_stack_pool, &p_stacks[i]) == 1;
+    print_test(name, "acquire", acquired );
+
+    stack_pool_push(p_stack_pool, p_stacks[4], A_key);
+    stack_pool_push(p_stack_pool, p_stacks[4], B_key);
+    print_test(name, "push_overflow", stack_pool_push(p_stack_pool, p_stacks[4], C_key) == 0 );
+    print_test(name, "peek", stack_pool_peek(p_stack_pool, p_stacks[4], &result) == 1 && result == B_key );
+    print_test(name, "pop", stack_pool_pop(p_stack_pool, p_stacks[4], &result) == 1 && result == B_key );
+    print_test(name, "other_empty", stack_pool_pop(p_stack_pool, p_stacks[3], &result) == 0 );
+
+    // Released stacks are reused, empty
+    p_reused = p_stacks[4];
+    stack_pool_release(p_stack_pool, &p_stacks[4]);
+    stack_pool_acquire(p_stack_pool, &p_stacks[4]);
+    print_test(name, "release_reuse", p_stacks[4] == p_reused && stack_pool_peek(p_stack_pool, p_stacks[4], &result) == 0 );
+
+    // Free the pool, and every stack
+    print_test(name, "destroy", stack_pool_destroy(&p_stack_pool) == 1 );
+
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+int test_splice ( char *name )
+{
+
+    // Initialized data
+    stack      *p_a     = 0,
+               *p_b     = 0,
+               *p_clone = 0;
+    const void *result  = 0;
+    size_t      count   = 0;
+
+    // Print the name of the scenario
+    log_scenario("%s\n", name);
+
+    // a = [ A, B, C ], b = [ _, _, _ ]
+    construct_AB_pushC_ABC(&p_a);
+    construct_empty(&p_b);
+
+    print_test(name, "splice_underflow", stack_splice(p_b, p_a, 4) == 0 );
+    print_test(name, "splice_same", stack_splice(p_a, p_a, 1) == 0 );
+
+    // a = [ A, _, _ ], b = [ B, C, _ ]
+    print_test(name, "splice_BC", stack_splice(p_b, p_a, 2) == 1 );
+    print_test(name, "splice_order", stack_get(p_b, 0, &result) == 1 && result == C_key && stack_get(p_b, 1, &result) == 1 && result == B_key );
+    print_test(name, "splice_overflow", stack_push(p_a, B_key) == 1 && stack_push(p_a, C_key) == 1 && stack_splice(p_b, p_a, 2) == 0 );
+
+    // a = [ A, B, C ], b = [ B, C, _ ] -> b = [ B, C, C ], a = [ A, B, _ ]
+    print_test(name, "steal_half", stack_steal_half(p_b, p_a, &count) == 1 && count == 1 && stack_peek(p_b, &result) == 1 && result == C_key );
+
+    // clone(a) = [ A, B, _ ]
+    print_test(name, "clone", stack_clone(p_a, &p_clone) == 1 && stack_pop(p_clone, &result) == 1 && result == B_key && stack_peek(p_a, &result) == 1 && result == B_key );
+
+    // Free the stacks
+    stack_destroy(&p_a);
+    stack_destroy(&p_b);
+    stack_destroy(&p_clone);
+
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+int test_drain ( char *name )
+{
+
+    // Initialized data
+    stack      *p_stack   = 0;
+    const void *values[3] = { 0 };
+    size_t      count     = 0;
+
+    // Print the name of the scenario
+    log_scenario("%s\n", name);
+
+    // [ A, B, C ] -> drain(2) -> [ A, _, _ ]
+    construct_AB_pushC_ABC(&p_stack);
+    print_test(name, "drain_partial", stack_drain(p_stack, values, 2, &count) == 1 && count == 2 && values[0] == B_key && values[1] == C_key );
+
+    // [ A, _, _ ] -> drain(3) -> [ _, _, _ ]
+    print_test(name, "drain_rest", stack_drain(p_stack, values, 3, &count) == 1 && count == 1 && values[0] == A_key );
+    print_test(name, "drain_empty", stack_drain(p_stack, values, 3, &count) == 1 && count == 0 );
+    print_test(name, "push_after_drain", stack_push(p_stack, A_key) == 1 );
+
+    // Free the stack
+    stack_destroy(&p_stack);
+
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+int watermark_highs = 0,
+    watermark_lows  = 0;
+
+void count_watermark ( stack *const p_stack, bool high )
+{
+
+    // Supress compiler warnings
+    (void) p_stack;
+
+    // Count the crossing
+    if ( high ) watermark_highs++;
+    else        watermark_lows++;
+
+    // Done
+    return;
+}
+
+int test_watermark ( char *name )
+{
+
+    // Initialized data
+    stack  *p_stack = 0;
+    size_t  count   = 0;
+
+    // Print the name of the scenario
+    log_scenario("%s\n", name);
+
+    // Construct a stack with watermarks at 2 and 0
+    construct_empty(&p_stack);
+    print_test(name, "bad_watermarks", stack_watermark_set(p_stack, 1, 1, count_watermark) == 0 );
+    print_test(name, "stack_watermark_set", stack_watermark_set(p_stack, 2, 0, count_watermark) == 1 );
+
+    // [ _, _, _ ] -> push(A) -> push(B) -> push(C) -> [ A, B, C ]
+    stack_push(p_stack, A_key);
+    print_test(name, "below_high", watermark_highs == 0 );
+    stack_push(p_stack, B_key);
+    stack_push(p_stack, C_key);
+    print_test(name, "high_once", watermark_highs == 1 );
+    print_test(name, "stack_count", stack_count(p_stack, &count) == 1 && count == 3 );
+
+    // [ A, B, C ] -> pop() -> pop() -> push(B) -> pop() -> pop() -> [ _, _, _ ]
+    stack_pop(p_stack, 0);
+    stack_pop(p_stack, 0);
+    stack_push(p_stack, B_key);
+    print_test(name, "no_low_no_high", watermark_highs == 1 && watermark_lows == 0 );
+    stack_pop(p_stack, 0);
+    stack_pop(p_stack, 0);
+    print_test(name, "low_once", watermark_lows == 1 );
+
+    // Free the stack
+    stack_destroy(&p_stack);
+
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+int test_shared ( char *name )
+{
+
+    // Print the name of the scenario
+    log_scenario("%s\n", name);
+
+    #ifdef __linux__
+
+        // Initialized data
+        shared_stack *p_shared_stack = 0,
+                     *p_attached     = 0;
+        size_t        region_size    = 0;
+        char         *p_region       = 0,
+                     *p_other        = 0;
+        void         *result         = 0;
+        int           fd             = -1;
+
+        print_test(name, "region_size_too_large", shared_stack_region_size(SIZE_MAX / 4, &region_size) == 0 );
+
+        // Room for a 2 element stack, followed by two buffers
+        shared_stack_region_size(2, &region_size);
+        p_region = calloc(region_size + 2, 1);
+
+        print_test(name, "attach_uninitialized", shared_stack_attach(&p_attached, p_region) == 0 );
+        print_test(name, "shared_stack_construct", shared_stack_construct(&p_shared_stack, p_region, region_size) == 1 );
+        print_test(name, "shared_stack_attach", shared_stack_attach(&p_attached, p_region) == 1 && p_attached == p_shared_stack );
+
+        // [ _, _ ] -> push(buffer 0) -> push(buffer 1) -> [ 0, 1 ]
+        shared_stack_push(p_shared_stack, &p_region[region_size]);
+        shared_stack_push(p_attached, &p_region[region_size + 1]);
+        print_test(name, "push_overflow", shared_stack_push(p_shared_stack, &p_region[region_size]) == 0 );
+        print_test(name, "peek", shared_stack_peek(p_shared_stack, &result) == 1 && result == &p_region[region_size + 1] );
+        print_test(name, "pop", shared_stack_pop(p_attached, &result) == 1 && result == &p_region[region_size + 1] );
+        print_test(name, "pop_pop", shared_stack_pop(p_shared_stack, &result) == 1 && result == &p_region[region_size] );
+        print_test(name, "pop_pop_pop", shared_stack_pop(p_shared_stack, &result) == 0 );
+
+        // Destroy the shared stack
+        shared_stack_destroy(&p_shared_stack);
+        print_test(name, "attach_destroyed", shared_stack_attach(&p_attached, p_region) == 0 );
+
+        // Free the region
+        free(p_region);
+
+        // Map one shared memory object twice, at different addresses
+        fd = memfd_create("stack_test", 0);
+        print_test(name, "memfd", fd != -1 && ftruncate(fd, region_size + 2) == 0 );
+        p_region = mmap(0, region_size + 2, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        p_other  = mmap(0, region_size + 2, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        shared_stack_construct(&p_shared_stack, p_region, region_size);
+        shared_stack_attach(&p_attached, p_other);
+
+        // Push through one mapping, pop through the other
+        shared_stack_push(p_shared_stack, &p_region[region_size]);
+        print_test(name, "mappings_differ", p_other != p_region && p_attached != p_shared_stack );
+        print_test(name, "remap_pop", shared_stack_pop(p_attached, &result) == 1 && result == &p_other[region_size] );
+
+        // The child pushes through a mapping of its own, the parent sees it
+        {
+
+            // Initialized data
+            int   status   = 0;
+            pid_t child    = fork();
+
+            if ( child == 0 )
+            {
+
+                // Initialized data
+                char *p_child = mmap(0, region_size + 2, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+                shared_stack_attach(&p_attached, p_child);
+                _exit( p_child != p_region && shared_stack_push(p_attached, &p_child[region_size]) == 1 ? EXIT_SUCCESS : EXIT_FAILURE );
+            }
+
+            waitpid(child, &status, 0);
+            print_test(name, "fork_push", WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS );
+            print_test(name, "fork_peek", shared_stack_peek(p_shared_stack, &result) == 1 && result == &p_region[region_size] );
+        }
+
+        // The child dies while it holds the lock
+        {
+
+            // Initialized data
+            int    status   = 0;
+            void **p_unused = mmap(0, sizeof(void *), PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            pid_t  child    = fork();
+
+            // Writing the popped value faults, before the element is removed
+            if ( child == 0 )
+            {
+                shared_stack_attach(&p_attached, p_region);
+                shared_stack_pop(p_attached, p_unused);
+                _exit(EXIT_SUCCESS);
+            }
+
+            waitpid(child, &status, 0);
+            print_test(name, "owner_died", !( WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS ) );
+            print_test(name, "owner_died_recover", shared_stack_pop(p_shared_stack, &result) == 1 && result == &p_region[region_size] );
+            print_test(name, "owner_died_usable", shared_stack_push(p_shared_stack, &p_region[region_size + 1]) == 1 && shared_stack_pop(p_shared_stack, &result) == 1 && result == &p_region[region_size + 1] );
+
+            munmap(p_unused, sizeof(void *));
+        }
+
+        // Destroy the shared stack
+        shared_stack_destroy(&p_shared_stack);
+
+        // Unmap the region
+        munmap(p_other, region_size + 2);
+        munmap(p_region, region_size + 2);
+        close(fd);
+    #endif
+
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+int test_frames ( char *name )
+{
+
+    // Initialized data
+    stack      *p_stack = 0;
+    const void *result  = 0;
+    size_t      frame   = 0,
+                count   = 0;
+
+    // Print the name of the scenario
+    log_scenario("%s\n", name);
+
+    // [ A, _, _ ] -> frame -> push(B) -> push(C) -> [ A | B, C ]
+    construct_empty_pushA_A(&p_stack);
+    print_test(name, "stack_frame_push", stack_frame_push(p_stack, &frame) == 1 && frame == 1 );
+    stack_push(p_stack, B_key);
+    stack_push(p_stack, C_key);
+
+    print_test(name, "frame_get_0", stack_frame_get(p_stack, frame, 0, &result) == 1 && result == B_key );
+    print_test(name, "frame_get_1", stack_frame_get(p_stack, frame, 1, &result) == 1 && result == C_key );
+    print_test(name, "frame_get_oob", stack_frame_get(p_stack, frame, 2, &result) == 0 );
+
+    // [ A | B, C ] -> pop frame -> [ A, _, _ ]
+    print_test(name, "stack_frame_pop", stack_frame_pop(p_stack, frame) == 1 && stack_count(p_stack, &count) == 1 && count == 1 );
+    print_test(name, "frame_pop_peek", stack_peek(p_stack, &result) == 1 && result == A_key );
+    print_test(name, "frame_pop_underflow", stack_frame_pop(p_stack, 2) == 0 );
+
+    // Free the stack
+    stack_destroy(&p_stack);
+
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+int test_priority ( char *name )
+{
+
+    // Initialized data
+    priority_stack *p_priority_stack = 0;
+    const void     *result           = 0;
+    size_t          level            = 0;
+
+    // Print the name of the scenario
+    log_scenario("%s\n", name);
+
+    // Construct a priority stack with 64 levels
+    print_test(name, "too_many_levels", priority_stack_construct(&p_priority_stack, 65, 2) == 0 );
+    print_test(name, "no_levels", priority_stack_construct(&p_priority_stack, 0, 2) == 0 );
+    print_test(name, "too_large", priority_stack_construct(&p_priority_stack, 64, SIZE_MAX / 64) == 0 );
+    priority_stack_construct(&p_priority_stack, 64, 2);
+
+    print_test(name, "empty_pop", priority_stack_pop(p_priority_stack, &result, &level) == 0 );
+    print_test(name, "bad_level", priority_stack_push(p_priority_stack, 64, A_key) == 0 );
+
+    // 0: [ A ], 63: [ B, C ]
+    priority_stack_push(p_priority_stack, 0, A_key);
+    priority_stack_push(p_priority_stack, 63, B_key);
+    priority_stack_push(p_priority_stack, 63, C_key);
+    print_test(name, "level_overflow", priority_stack_push(p_priority_stack, 63, X_key) == 0 );
+
+    print_test(name, "peek_C", priority_stack_peek(p_priority_stack, &result, &level) == 1 && result == C_key && level == 63 );
+    print_test(name, "pop_C", priority_stack_pop(p_priority_stack, &result, &level) == 1 && result == C_key && level == 63 );
+    print_test(name, "pop_B", priority_stack_pop(p_priority_stack, &result, &level) == 1 && result == B_key && level == 63 );
+    print_test(name, "pop_A", priority_stack_pop(p_priority_stack, &result, &level) == 1 && result == A_key && level == 0 );
+    print_test(name, "pop_pop_pop_pop", priority_stack_pop(p_priority_stack, &result, &level) == 0 );
+
+    // Free the priority stack
+    priority_stack_destroy(&p_priority_stack);
+
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+int test_ring ( char *name )
+{
+
+    // Initialized data
+    ring_stack *p_ring_stack = 0;
+    const void *result       = 0,
+               *evicted      = 0;
+    size_t      count        = 0,
+                evictions    = 0;
+
+    // Print the name of the scenario
+    log_scenario("%s\n", name);
+
+    // [ _, _ ] -> push(A) -> push(B) -> [ A, B ]
+    print_test(name, "construct_too_large", ring_stack_construct(&p_ring_stack, SIZE_MAX / 4) == 0 );
+    ring_stack_construct(&p_ring_stack, 2);
+    ring_stack_push(p_ring_stack, A_key, &evicted);
+    print_test(name, "push_no_eviction", evicted == 0 );
+    ring_stack_push(p_ring_stack, B_key, 0);
+
+    // [ A, B ] -> push(C) -> [ B, C ]
+    print_test(name, "push_evicts_A", ring_stack_push(p_ring_stack, C_key, &evicted) == 1 && evicted == A_key );
+    print_test(name, "get_0", ring_stack_get(p_ring_stack, 0, &result) == 1 && result == C_key );
+    print_test(name, "get_1", ring_stack_get(p_ring_stack, 1, &result) == 1 && result == B_key );
+    print_test(name, "get_oob", ring_stack_get(p_ring_stack, 2, &result) == 0 );
+    print_test(name, "count", ring_stack_count(p_ring_stack, &count, &evictions) == 1 && count == 2 && evictions == 1 );
+
+    // [ B, C ] -> push(X) -> [ C, X ] -> pop() -> pop() -> [ _, _ ]
+    ring_stack_push(p_ring_stack, X_key, &evicted);
+    print_test(name, "pop_X", ring_stack_pop(p_ring_stack, &result) == 1 && result == X_key );
+    print_test(name, "pop_C", ring_stack_pop(p_ring_stack, &result) == 1 && result == C_key );
+    print_test(name, "pop_pop_pop", ring_stack_pop(p_ring_stack, &result) == 0 );
+
+    // Free the ring stack
+    ring_stack_destroy(&p_ring_stack);
+
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+size_t string_hash ( const void *const p_value )
+{
+
+    // Initialized data
+    size_t hash = 5381;
+
+    // djb2
+    for (const char *p = p_value; *p; p++)
+        hash = ( hash * 33 ) ^ (unsigned char) *p;
+
+    // Success
+    return hash;
+}
+
+bool string_equal ( const void *const p_a, const void *const p_b )
+{
+
+    // Success
+    return strcmp(p_a, p_b) == 0;
+}
+
+int test_mru ( char *name )
+{
+
+    // Initialized data
+    mru_stack  *p_mru_stack = 0;
+    const void *result      = 0,
+               *evicted     = 0;
+    size_t      count       = 0;
+    char        a_copy[]    = "A";
+
+    // Print the name of the scenario
+    log_scenario("%s\n", name);
+
+    // [ _, _, _ ] -> push(A) -> push(B) -> push(C) -> [ A, B, C ]
+    print_test(name, "construct_too_large", mru_stack_construct(&p_mru_stack, SIZE_MAX / 2, 0, 0) == 0 );
+    mru_stack_construct(&p_mru_stack, 3, 0, 0);
+    mru_stack_push(p_mru_stack, A_key, 0);
+    mru_stack_push(p_mru_stack, B_key, 0);
+    mru_stack_push(p_mru_stack, C_key, 0);
+
+    // [ A, B, C ] -> touch(A) -> [ B, C, A ]
+    print_test(name, "touch_A", mru_stack_touch(p_mru_stack, A_key, &result) == 1 && result == A_key );
+    print_test(name, "peek_A", mru_stack_peek(p_mru_stack, &result) == 1 && result == A_key );
+    print_test(name, "touch_X", mru_stack_touch(p_mru_stack, X_key, &result) == 0 );
+
+    // [ B, C, A ] -> push(C) -> [ B, A, C ]
+    print_test(name, "push_present", mru_stack_push(p_mru_stack, C_key, &evicted) == 1 && evicted == 0 );
+    print_test(name, "count_3", mru_stack_count(p_mru_stack, &count) == 1 && count == 3 );
+
+    // [ B, A, C ] -> push(X) -> [ A, C, X ]
+    print_test(name, "push_evicts_B", mru_stack_push(p_mru_stack, X_key, &evicted) == 1 && evicted == B_key );
+
+    // [ A, C, X ] -> remove(C) -> [ A, X ]
+    print_test(name, "remove_C", mru_stack_remove(p_mru_stack, C_key, &result) == 1 && result == C_key );
+    print_test(name, "remove_C_again", mru_stack_remove(p_mru_stack, C_key, &result) == 0 );
+
+    // [ A, X ] -> pop_bottom() -> pop() -> [ _, _, _ ]
+    print_test(name, "pop_bottom_A", mru_stack_pop_bottom(p_mru_stack, &result) == 1 && result == A_key );
+    print_test(name, "pop_X", mru_stack_pop(p_mru_stack, &result) == 1 && result == X_key );
+    print_test(name, "pop_empty", mru_stack_pop(p_mru_stack, &result) == 0 );
+
+    // Free the MRU stack
+    mru_stack_destroy(&p_mru_stack);
+
+    // Compare by value, so a copy of A replaces A
+    mru_stack_construct(&p_mru_stack, 2, string_hash, string_equal);
+    mru_stack_push(p_mru_stack, A_key, 0);
+    mru_stack_push(p_mru_stack, B_key, 0);
+    print_test(name, "push_equal_replaces", mru_stack_push(p_mru_stack, a_copy, &evicted) == 1 && evicted == A_key );
+    print_test(name, "touch_equal", mru_stack_touch(p_mru_stack, "A", &result) == 1 && result == a_copy );
+
+    // Free the MRU stack
+    mru_stack_destroy(&p_mru_stack);
+
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+int test_intrusive ( char *name )
+{
+
+    // Object with an embedded node
+    struct object_s
+    {
+        int        value;
+        stack_node node;
+    } objects[3] = { { .value = 0 }, { .value = 1 }, { .value = 2 } };
+
+    // Initialized data
+    intrusive_stack *p_intrusive_stack = 0;
+    lockfree_stack  *p_lockfree_stack  = 0;
+    stack_node      *p_node            = 0;
+
+    // Print the name of the scenario
+    log_scenario("%s\n", name);
+
+    // [ ] -> push(0) -> push(1) -> push(2) -> [ 0, 1, 2 ]
+    intrusive_stack_construct(&p_intrusive_stack);
+    for (size_t i = 0; i < 3; i++) intrusive_stack_push(p_intrusive_stack, &objects[i].node);
+
+    print_test(name, "intrusive_peek_2", intrusive_stack_peek(p_intrusive_stack, &p_node) == 1 && STACK_CONTAINER_OF(p_node, struct object_s, node)->value == 2 );
+    print_test(name, "intrusive_pop_2", intrusive_stack_pop(p_intrusive_stack, &p_node) == 1 && STACK_CONTAINER_OF(p_node, struct object_s, node) == &objects[2] );
+
+    // [ 0, 1 ] -> pop_all() -> [ ]
+    print_test(name, "intrusive_pop_all", intrusive_stack_pop_all(p_intrusive_stack, &p_node) == 1 && p_node == &objects[1].node && p_node->p_next == &objects[0].node && p_node->p_next->p_next == 0 );
+    print_test(name, "intrusive_pop_empty", intrusive_stack_pop(p_intrusive_stack, &p_node) == 0 );
+
+    // [ 0 ] + [ 1, 2 ] -> splice -> [ 0, 1, 2 ] + [ ]
+    {
+
+        // Initialized data
+        intrusive_stack *p_source = 0;
+
+        intrusive_stack_construct(&p_source);
+        intrusive_stack_push(p_intrusive_stack, &objects[0].node);
+        intrusive_stack_push(p_source, &objects[1].node);
+        intrusive_stack_push(p_source, &objects[2].node);
+
+        print_test(name, "intrusive_splice", intrusive_stack_splice(p_intrusive_stack, p_source) == 1 && intrusive_stack_pop(p_source, &p_node) == 0 );
+        print_test(name, "intrusive_splice_order", intrusive_stack_pop_all(p_intrusive_stack, &p_node) == 1 && p_node == &objects[2].node && p_node->p_next == &objects[1].node && p_node->p_next->p_next == &objects[0].node && p_node->p_next->p_next->p_next == 0 );
+
+        // [ ] + [ 1 ] -> splice -> [ 1 ] + [ ], then splice back onto an empty source
+        intrusive_stack_push(p_source, &objects[1].node);
+        intrusive_stack_splice(p_intrusive_stack, p_source);
+        intrusive_stack_splice(p_source, p_intrusive_stack);
+        intrusive_stack_push(p_source, &objects[2].node);
+        print_test(name, "intrusive_splice_empty", intrusive_stack_pop_all(p_source, &p_node) == 1 && p_node == &objects[2].node && p_node->p_next == &objects[1].node && p_node->p_next->p_next == 0 );
+        print_test(name, "intrusive_splice_self", intrusive_stack_splice(p_source, p_source) == 0 );
+
+        // Free the source
+        intrusive_stack_destroy(&p_source);
+    }
+
+    // Free the intrusive stack
+    intrusive_stack_destroy(&p_intrusive_stack);
+
+    // [ ] -> push(0) -> push(1) -> push(2) -> [ 0, 1, 2 ]
+    lockfree_stack_construct(&p_lockfree_stack);
+    for (size_t i = 0; i < 3; i++) lockfree_stack_push(p_lockfree_stack, &objects[i].node);
+
+    print_test(name, "lockfree_pop_2", lockfree_stack_pop(p_lockfree_stack, &p_node) == 1 && STACK_CONTAINER_OF(p_node, struct object_s, node)->value == 2 );
+
+    // [ 0, 1 ] -> push(2) -> pop() -> [ 0, 1 ]
+    lockfree_stack_push(p_lockfree_stack, &objects[2].node);
+    print_test(name, "lockfree_pop_2_again", lockfree_stack_pop(p_lockfree_stack, &p_node) == 1 && p_node == &objects[2].node );
+
+    // [ 0, 1 ] -> pop_all() -> [ ]
+    print_test(name, "lockfree_pop_all", lockfree_stack_pop_all(p_lockfree_stack, &p_node) == 1 && p_node == &objects[1].node && p_node->p_next == &objects[0].node );
+    print_test(name, "lockfree_pop_empty", lockfree_stack_pop(p_lockfree_stack, &p_node) == 0 );
+
+    // Free the lock free stack
+    lockfree_stack_destroy(&p_lockfree_stack);
+
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
 int print_test ( const char *scenario_name, const char *test_name, bool passed )
 { 
 
@@ -0,0 +1,196 @@
+/** !
+ * stack C++ interface tester
+ *
+ * @file stack_test.cpp
+ *
+ * @author Jacob Smith
+*/
+
+// Include
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <utility>
+
+#include <stack/stack.hpp>
+
+// Data
+static int total_tests  = 0,
+           total_passes = 0;
+
+// Throws from its move constructor after a quantity of moves
+struct thrower
+{
+    static inline int live  = 0;  // The quantity of instances alive
+    static inline int moves = -1; // The quantity of moves until one throws, or -1 to never throw
+
+    std::string value;
+
+    explicit thrower ( std::string v ) : value(std::move(v)) { live++; }
+    thrower ( const thrower &other ) : value(other.value) { live++; }
+    thrower ( thrower &&other ) : value(other.value)
+    {
+        if ( moves == 0 ) throw 1;
+        if ( moves >  0 ) moves--;
+        live++;
+    }
+    ~thrower ( void ) { live--; }
+};
+
+// Forward declarations
+void print_test ( const char *scenario_name, const char *test_name, bool passed );
+
+template <typename LockPolicy, std::size_t Capacity>
+void test_stack ( const char *name );
+
+// Construct a stack of three elements, whatever the storage
+template <typename T, typename LockPolicy, std::size_t Capacity>
+stk::stack<T, LockPolicy, Capacity> make_stack ( void )
+{
+    if constexpr ( Capacity == 0 ) return stk::stack<T, LockPolicy, Capacity>(3);
+    else                           return stk::stack<T, LockPolicy, Capacity>();
+}
+
+// Entry point
+int main ( int argc, const char *argv[] )
+{
+
+    // Supress compiler warnings
+    (void) argc;
+    (void) argv;
+
+    // Formatting
+    printf(
+        "╭──────────────────╮\n"\
+        "│ stack C++ tester │\n"\
+        "╰──────────────────╯\n\n"
+    );
+
+    // Heap storage
+    test_stack<stk::lock::locked,         0>("heap_locked");
+    test_stack<stk::lock::spin,           0>("heap_spin");
+    test_stack<stk::lock::unsynchronized, 0>("heap_unsynchronized");
+
+    // Inline storage
+    test_stack<stk::lock::locked,         3>("inline_locked");
+    test_stack<stk::lock::spin,           3>("inline_spin");
+    test_stack<stk::lock::unsynchronized, 3>("inline_unsynchronized");
+
+    // Report
+    printf("\nTotal: %d, Passed: %d, Failed: %d\n", total_tests, total_passes, total_tests - total_passes);
+
+    // Flush stdio
+    fflush(stdout);
+
+    // Exit
+    return ( total_passes == total_tests ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+template <typename LockPolicy, std::size_t Capacity>
+void test_stack ( const char *name )
+{
+
+    // Initialized data
+    auto        s     = make_stack<std::string, LockPolicy, Capacity>();
+    std::string value = "B";
+
+    // Print the name of the scenario
+    printf("Scenario: %s\n", name);
+
+    // [ _, _, _ ] -> emplace(A) -> push(B) -> push(C) -> [ A, B, C ]
+    print_test(name, "empty", s.empty() && s.capacity() == 3 && !s.try_peek() && !s.try_pop() );
+    print_test(name, "emplace_A", s.emplace(1, 'A') );
+    print_test(name, "push_copy_B", s.push(value) && value == "B" );
+    print_test(name, "push_move_C", s.push(std::string("C")) );
+    print_test(name, "push_full", !s.push("X") && s.size() == 3 );
+    print_test(name, "peek_C", s.try_peek() == "C" && s.size() == 3 );
+
+    // [ A, B, C ] -> move construct -> [ A, B, C ]
+    auto t = std::move(s);
+    print_test(name, "move_construct", t.size() == 3 && s.empty() && t.try_peek() == "C" );
+
+    // [ A, B, C ] -> pop() -> [ A, B ]
+    print_test(name, "pop_C", t.try_pop() == "C" && t.size() == 2 );
+
+    // [ A, B ] -> move assign -> [ A, B ]
+    s = std::move(t);
+    print_test(name, "move_assign", s.size() == 2 && t.empty() && s.try_peek() == "B" );
+    t = std::move(s);
+    print_test(name, "move_assign_back", t.try_pop() == "B" && t.try_pop() == "A" && !t.try_pop() );
+
+    // [ _, _, _ ] -> push(A) -> push(B) -> clear() -> [ _, _, _ ]
+    t.push("A");
+    t.push("B");
+    t.clear();
+    print_test(name, "clear", t.empty() && !t.try_peek() && t.push("A") );
+
+    // A throwing move leaves the top in place
+    {
+
+        // Initialized data
+        auto u     = make_stack<thrower, LockPolicy, Capacity>();
+        bool threw = false;
+
+        u.emplace("A");
+        u.emplace("B");
+
+        // Pop with a throwing move
+        thrower::moves = 0;
+        try { (void) u.try_pop(); } catch ( int ) { threw = true; }
+        thrower::moves = -1;
+
+        print_test(name, "pop_throws", threw && u.size() == 2 );
+        print_test(name, "pop_after_throw", u.try_pop()->value == "B" && u.try_pop()->value == "A" && u.empty() );
+    }
+
+    // A throwing move part way through moving a stack leaks nothing
+    {
+
+        // Initialized data
+        auto u           = make_stack<thrower, LockPolicy, Capacity>();
+        auto v           = make_stack<thrower, LockPolicy, Capacity>();
+        bool constructed = true,
+             assigned    = true;
+
+        u.emplace("A");
+        u.emplace("B");
+        u.emplace("C");
+        v.emplace("X");
+
+        // Move construct, throwing on the second element
+        thrower::moves = 1;
+        try { auto w = std::move(u); } catch ( int ) { constructed = false; }
+
+        // Move assign, throwing on the third element
+        thrower::moves = 2;
+        try { v = std::move(u); } catch ( int ) { assigned = false; }
+        thrower::moves = -1;
+
+        // Heap storage hands over its buffer without moving any element
+        if constexpr ( Capacity == 0 )
+            print_test(name, "move_no_throw", constructed && assigned && u.empty() && v.empty() && thrower::live == 0 );
+
+        // Inline storage keeps the source intact, and destroys what was built
+        else
+        {
+            print_test(name, "move_construct_throws", !constructed && u.size() == 3 );
+            print_test(name, "move_assign_throws", !assigned && v.empty() && u.size() == 3 && thrower::live == 3 );
+            print_test(name, "move_after_throw", u.try_pop()->value == "C" && u.try_pop()->value == "B" );
+        }
+    }
+    print_test(name, "no_leaks", thrower::live == 0 );
+
+    // Formatting
+    printf("\n");
+}
+
+void print_test ( const char *scenario_name, const char *test_name, bool passed )
+{
+
+    // Print the result
+    printf("%s %s %s\n", passed ? "PASS" : "FAIL", scenario_name, test_name);
+
+    // Increment the counters
+    total_tests++;
+    if ( passed ) total_passes++;
+}